@@ -0,0 +1,232 @@
+/***********************************************************************************************************************
+ *
+ * Copyright (c) 2026, ABB Schweiz AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with
+ * or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer in the documentation
+ *      and/or other materials provided with the
+ *      distribution.
+ *    * Neither the name of ABB nor the names of its
+ *      contributors may be used to endorse or promote
+ *      products derived from this software without
+ *      specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ***********************************************************************************************************************
+ */
+
+#ifndef RWS_ADAPTIVE_TIMEOUT_H
+#define RWS_ADAPTIVE_TIMEOUT_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Poco/Foundation.h"
+#include "Poco/Mutex.h"
+
+namespace abb
+{
+namespace rws
+{
+/**
+ * \brief A class for deriving HTTP communication timeouts from observed round-trip times (RTTs).
+ *
+ * The RTTs are kept in one histogram per endpoint class (i.e. per method and resource group, see classify(...)), so
+ * that e.g. cheap IO signal reads get a tight timeout, while large configuration documents get a generous one. The
+ * timeout is a configurable percentile of the histogram, plus a margin, clamped to a floor and a ceiling.
+ *
+ * Old observations are gradually forgotten, so that the timeouts follow changes in the controller's load.
+ */
+class AdaptiveTimeout
+{
+public:
+  /**
+   * \brief A struct for containing the adaptive timeout's configuration.
+   */
+  struct Configuration
+  {
+    /**
+     * \brief The percentile (in the range (0, 1]) of the observed RTTs that the timeout is based on.
+     */
+    double percentile;
+
+    /**
+     * \brief Factor that the percentile is multiplied with.
+     */
+    double margin_factor;
+
+    /**
+     * \brief Margin added to the (multiplied) percentile [microseconds].
+     */
+    Poco::Int64 margin;
+
+    /**
+     * \brief The lowest timeout that is used [microseconds].
+     */
+    Poco::Int64 min_timeout;
+
+    /**
+     * \brief The highest timeout that is used [microseconds].
+     */
+    Poco::Int64 max_timeout;
+
+    /**
+     * \brief Number of observations an endpoint class needs, before its timeout is adapted.
+     */
+    unsigned int min_samples;
+
+    /**
+     * \brief Number of observations after which the old observations' weights are halved.
+     */
+    unsigned int window;
+
+    /**
+     * \brief A default constructor.
+     */
+    Configuration()
+    :
+    percentile(0.99),
+    margin_factor(1.5),
+    margin(10000),
+    min_timeout(30000),
+    max_timeout(5000000),
+    min_samples(20),
+    window(1000)
+    {}
+  };
+
+  /**
+   * \brief A constructor.
+   *
+   * \param configuration for the adaptive timeout's configuration.
+   */
+  explicit AdaptiveTimeout(const Configuration& configuration = Configuration());
+
+  /**
+   * \brief A method for retrieving the timeout for an endpoint class.
+   *
+   * \param endpoint_class for the endpoint class.
+   * \param default_timeout for the timeout [microseconds] to use, until enough RTTs have been observed.
+   *
+   * \return Poco::Int64 containing the timeout [microseconds].
+   */
+  Poco::Int64 getTimeout(const std::string& endpoint_class, const Poco::Int64 default_timeout);
+
+  /**
+   * \brief A method for recording an observed RTT.
+   *
+   * Note: For requests that timed out, record the timeout that was used. The true RTT is at least that long, so
+   *       this lets the timeout grow again if it has become too tight.
+   *
+   * \param endpoint_class for the endpoint class.
+   * \param rtt for the observed RTT [microseconds].
+   */
+  void record(const std::string& endpoint_class, const Poco::Int64 rtt);
+
+  /**
+   * \brief A method for classifying a request into an endpoint class.
+   *
+   * The class consists of the method and the first two segments of the URI's path (e.g. "GET /rw/iosystem").
+   *
+   * \param method for the request's method.
+   * \param uri for the request's URI (path and query).
+   *
+   * \return std::string containing the endpoint class.
+   */
+  static std::string classify(const std::string& method, const std::string& uri);
+
+private:
+  /**
+   * \brief A struct for representing a histogram of RTTs, with logarithmically sized buckets.
+   */
+  struct Histogram
+  {
+    /**
+     * \brief A default constructor.
+     */
+    Histogram() : buckets(NUMBER_OF_BUCKETS, 0), samples(0) {}
+
+    /**
+     * \brief Number of (weighted) observations per bucket.
+     */
+    std::vector<unsigned int> buckets;
+
+    /**
+     * \brief Total number of (weighted) observations.
+     */
+    unsigned int samples;
+  };
+
+  /**
+   * \brief A method for calculating the bucket that a RTT belongs to.
+   *
+   * \param rtt for the RTT [microseconds].
+   *
+   * \return size_t containing the bucket's index.
+   */
+  static size_t getBucket(const Poco::Int64 rtt);
+
+  /**
+   * \brief A method for calculating a bucket's upper bound.
+   *
+   * \param bucket for the bucket's index.
+   *
+   * \return Poco::Int64 containing the upper bound [microseconds].
+   */
+  static Poco::Int64 getUpperBound(const size_t bucket);
+
+  /**
+   * \brief Static constant for the number of buckets in a histogram.
+   */
+  static const size_t NUMBER_OF_BUCKETS = 64;
+
+  /**
+   * \brief Static constant for the first bucket's upper bound [microseconds].
+   */
+  static const Poco::Int64 FIRST_BUCKET_BOUND = 500;
+
+  /**
+   * \brief Static constant for the growth factor between consecutive buckets' upper bounds.
+   */
+  static const double BUCKET_GROWTH;
+
+  /**
+   * \brief The adaptive timeout's configuration.
+   */
+  const Configuration configuration_;
+
+  /**
+   * \brief A mutex for protecting the histograms.
+   */
+  Poco::Mutex mutex_;
+
+  /**
+   * \brief The histograms, per endpoint class.
+   */
+  std::map<std::string, Histogram> histograms_;
+};
+
+} // end namespace rws
+} // end namespace abb
+
+#endif
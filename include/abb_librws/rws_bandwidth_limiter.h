@@ -0,0 +1,153 @@
+/***********************************************************************************************************************
+ *
+ * Copyright (c) 2026, ABB Schweiz AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with
+ * or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer in the documentation
+ *      and/or other materials provided with the
+ *      distribution.
+ *    * Neither the name of ABB nor the names of its
+ *      contributors may be used to endorse or promote
+ *      products derived from this software without
+ *      specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ***********************************************************************************************************************
+ */
+
+#ifndef RWS_BANDWIDTH_LIMITER_H
+#define RWS_BANDWIDTH_LIMITER_H
+
+#include <string>
+
+#include "Poco/Mutex.h"
+#include "Poco/SharedPtr.h"
+#include "Poco/Timestamp.h"
+
+namespace abb
+{
+namespace rws
+{
+/**
+ * \brief A class for a token bucket, which limits the bandwidth used by transfers (e.g. file service transfers).
+ *
+ * The bucket is refilled at the configured rate, and it holds at most the configured burst. Transfers reserve their
+ * chunks before transferring them, and are told how long to wait if the bucket has run dry. Since the reservations
+ * are made in advance (i.e. the bucket may go into debt), concurrent transfers share the rate fairly.
+ *
+ * Limiters can be used per client, and shared per controller (see getInstance(...)). Both are unlimited by default.
+ */
+class BandwidthLimiter
+{
+public:
+  /**
+   * \brief A constructor.
+   *
+   * \param rate for the maximum average rate [bytes per second] (zero for unlimited).
+   * \param burst for the maximum burst [bytes] (zero for a default of a quarter of a second at the rate).
+   */
+  explicit BandwidthLimiter(const Poco::UInt64 rate = 0, const Poco::UInt64 burst = 0);
+
+  /**
+   * \brief A method for changing the limit (the change applies immediately, also to transfers in progress).
+   *
+   * \param rate for the maximum average rate [bytes per second] (zero for unlimited).
+   * \param burst for the maximum burst [bytes] (zero for a default of a quarter of a second at the rate).
+   */
+  void setLimit(const Poco::UInt64 rate, const Poco::UInt64 burst = 0);
+
+  /**
+   * \brief A method for retrieving the maximum average rate.
+   *
+   * \return Poco::UInt64 containing the rate [bytes per second] (zero if unlimited).
+   */
+  Poco::UInt64 getRate();
+
+  /**
+   * \brief A method for reserving bandwidth for a chunk, which is about to be transferred.
+   *
+   * \param size for the chunk's size [bytes].
+   *
+   * \return Poco::Int64 containing the time [microseconds] to wait before the chunk is transferred.
+   */
+  Poco::Int64 reserve(const size_t size);
+
+  /**
+   * \brief A method for retrieving the number of bytes that have been reserved.
+   *
+   * \return Poco::UInt64 containing the number of bytes.
+   */
+  Poco::UInt64 getNumberOfReservedBytes();
+
+  /**
+   * \brief A method for retrieving the (process wide) limiter for a controller.
+   *
+   * \param ip_address for the controller's IP address.
+   * \param port for the controller's port.
+   *
+   * \return Poco::SharedPtr<BandwidthLimiter> for the limiter.
+   */
+  static Poco::SharedPtr<BandwidthLimiter> getInstance(const std::string& ip_address, const Poco::UInt16 port);
+
+private:
+  /**
+   * \brief A method for refilling the bucket, according to the time passed since the last refill.
+   *
+   * Note: The limiter's mutex must be held by the caller.
+   */
+  void refill();
+
+  /**
+   * \brief Mutex for protecting the limiter.
+   */
+  Poco::Mutex mutex_;
+
+  /**
+   * \brief The maximum average rate [bytes per second] (zero for unlimited).
+   */
+  Poco::UInt64 rate_;
+
+  /**
+   * \brief The maximum burst [bytes].
+   */
+  Poco::Int64 burst_;
+
+  /**
+   * \brief The number of available bytes in the bucket (negative if reservations have been made in advance).
+   */
+  double tokens_;
+
+  /**
+   * \brief The point in time of the last refill.
+   */
+  Poco::Timestamp last_refill_;
+
+  /**
+   * \brief The number of bytes that have been reserved.
+   */
+  Poco::UInt64 reserved_bytes_;
+};
+
+} // end namespace rws
+} // end namespace abb
+
+#endif
@@ -0,0 +1,160 @@
+/***********************************************************************************************************************
+ *
+ * Copyright (c) 2026, ABB Schweiz AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with
+ * or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer in the documentation
+ *      and/or other materials provided with the
+ *      distribution.
+ *    * Neither the name of ABB nor the names of its
+ *      contributors may be used to endorse or promote
+ *      products derived from this software without
+ *      specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ***********************************************************************************************************************
+ */
+
+#ifndef RWS_CANCELLATION_TOKEN_H
+#define RWS_CANCELLATION_TOKEN_H
+
+#include <atomic>
+#include <functional>
+#include <map>
+
+#include "Poco/Event.h"
+#include "Poco/Mutex.h"
+#include "Poco/SharedPtr.h"
+
+namespace abb
+{
+namespace rws
+{
+/**
+ * \brief A class for cancelling requests, and transfers, that are in progress (or that have not started yet).
+ *
+ * A token is attached to the options of one or more requests (see POCOClient::RequestOptions). Cancelling the token
+ * shuts down the sockets that the requests are using, which makes blocked socket operations return promptly. Only
+ * the affected connections are closed, i.e. the session remains valid and can be used by later requests.
+ *
+ * A cancelled token stays cancelled. Use a new token for new requests.
+ */
+class CancellationToken
+{
+public:
+  /**
+   * \brief A callback, which is called (once) when the token is cancelled.
+   *
+   * Note: The callback is called while the token's mutex is held, i.e. it must be short and must not use the token.
+   */
+  typedef std::function<void()> Callback;
+
+  /**
+   * \brief A class for registering a callback, which is unregistered when the object goes out of scope.
+   *
+   * Note: The callback is never called after the destructor has returned.
+   */
+  class Registration
+  {
+  public:
+    /**
+     * \brief A constructor.
+     *
+     * \param p_token for the token to register the callback with (a null pointer results in a no-op).
+     * \param callback for the callback (not called if the token has already been cancelled).
+     */
+    Registration(const Poco::SharedPtr<CancellationToken>& p_token, const Callback& callback);
+
+    /**
+     * \brief A destructor.
+     */
+    ~Registration();
+
+  private:
+    /**
+     * \brief The token that the callback is registered with (null if not registered).
+     */
+    Poco::SharedPtr<CancellationToken> p_token_;
+
+    /**
+     * \brief The registration's id.
+     */
+    unsigned int id_;
+  };
+
+  /**
+   * \brief A default constructor.
+   */
+  CancellationToken();
+
+  /**
+   * \brief A method for cancelling the token, i.e. the requests that use it.
+   */
+  void cancel();
+
+  /**
+   * \brief A method for checking if the token has been cancelled.
+   *
+   * \return bool indicating if the token has been cancelled.
+   */
+  bool isCancelled() const { return cancelled_; }
+
+  /**
+   * \brief A method for waiting until the token is cancelled, or a timeout has passed (e.g. instead of sleeping).
+   *
+   * \param timeout for the maximum time to wait [milliseconds].
+   *
+   * \return bool indicating if the token has been cancelled.
+   */
+  bool waitForCancellation(const long timeout);
+
+private:
+  /**
+   * \brief Flag indicating if the token has been cancelled (readable without the mutex).
+   */
+  std::atomic<bool> cancelled_;
+
+  /**
+   * \brief A manual-reset event, which is set when the token is cancelled.
+   */
+  Poco::Event event_;
+
+  /**
+   * \brief Mutex for protecting the callbacks.
+   */
+  Poco::Mutex mutex_;
+
+  /**
+   * \brief The registered callbacks (mapped by registration id).
+   */
+  std::map<unsigned int, Callback> callbacks_;
+
+  /**
+   * \brief The id of the next registration.
+   */
+  unsigned int next_id_;
+};
+
+} // end namespace rws
+} // end namespace abb
+
+#endif
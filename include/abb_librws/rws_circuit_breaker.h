@@ -0,0 +1,185 @@
+/***********************************************************************************************************************
+ *
+ * Copyright (c) 2026, ABB Schweiz AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with
+ * or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer in the documentation
+ *      and/or other materials provided with the
+ *      distribution.
+ *    * Neither the name of ABB nor the names of its
+ *      contributors may be used to endorse or promote
+ *      products derived from this software without
+ *      specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ***********************************************************************************************************************
+ */
+
+#ifndef RWS_CIRCUIT_BREAKER_H
+#define RWS_CIRCUIT_BREAKER_H
+
+#include <string>
+
+#include "Poco/Mutex.h"
+#include "Poco/SharedPtr.h"
+#include "Poco/Timestamp.h"
+
+namespace abb
+{
+namespace rws
+{
+/**
+ * \brief A class for a circuit breaker, which makes requests fail fast while a controller is unresponsive.
+ *
+ * The breaker opens after a number of consecutive failures, and then rejects all requests for a while. After that,
+ * a single probe request is let through (half-open state). If the probe succeeds, then the breaker closes again,
+ * otherwise it reopens.
+ *
+ * Breakers are shared per controller (see getInstance(...)), so that all clients to the same controller benefit.
+ */
+class CircuitBreaker
+{
+public:
+  /**
+   * \brief An enum for the breaker's states.
+   */
+  enum State
+  {
+    CLOSED,   ///< Requests are let through.
+    OPEN,     ///< Requests are rejected.
+    HALF_OPEN ///< A single probe request is let through.
+  };
+
+  /**
+   * \brief A struct for containing the breaker's configuration.
+   */
+  struct Configuration
+  {
+    /**
+     * \brief The number of consecutive failures that opens the breaker.
+     */
+    unsigned int failure_threshold;
+
+    /**
+     * \brief How long the breaker stays open before letting a probe request through [microseconds].
+     */
+    Poco::Int64 open_duration;
+
+    /**
+     * \brief A default constructor.
+     */
+    Configuration() : failure_threshold(5), open_duration(1000000) {}
+  };
+
+  /**
+   * \brief A constructor.
+   *
+   * \param configuration for the breaker's configuration.
+   */
+  explicit CircuitBreaker(const Configuration& configuration = Configuration());
+
+  /**
+   * \brief A method for checking if a request may be sent.
+   *
+   * \return bool indicating if the request may be sent. If true, then the outcome must be reported with record(...).
+   */
+  bool allowRequest();
+
+  /**
+   * \brief A method for reporting the outcome of a request.
+   *
+   * \param success indicating if the controller responded (i.e. a failure means that it was unresponsive).
+   */
+  void record(const bool success);
+
+  /**
+   * \brief A method for giving up a request that was allowed, but never sent (i.e. without reporting an outcome).
+   *
+   * If the request was the probe of the half-open state, then another probe request is let through.
+   */
+  void abandonProbe();
+
+  /**
+   * \brief A method for retrieving the breaker's state.
+   *
+   * \return State containing the state.
+   */
+  State getState();
+
+  /**
+   * \brief A method for retrieving the number of requests rejected by the breaker.
+   *
+   * \return Poco::UInt64 containing the number of rejected requests.
+   */
+  Poco::UInt64 getNumberOfRejectedRequests();
+
+  /**
+   * \brief A method for retrieving the (process wide) breaker for a controller.
+   *
+   * \param ip_address for the controller's IP address.
+   * \param port for the controller's port.
+   *
+   * \return Poco::SharedPtr<CircuitBreaker> for the breaker (it is created on first use).
+   */
+  static Poco::SharedPtr<CircuitBreaker> getInstance(const std::string& ip_address, const Poco::UInt16 port);
+
+private:
+  /**
+   * \brief The breaker's configuration.
+   */
+  const Configuration configuration_;
+
+  /**
+   * \brief A mutex for protecting the breaker's state.
+   */
+  Poco::Mutex mutex_;
+
+  /**
+   * \brief The breaker's state.
+   */
+  State state_;
+
+  /**
+   * \brief The number of consecutive failures.
+   */
+  unsigned int consecutive_failures_;
+
+  /**
+   * \brief Time when the breaker was opened.
+   */
+  Poco::Timestamp opened_time_;
+
+  /**
+   * \brief Flag indicating if a probe request is outstanding (in the half-open state).
+   */
+  bool probing_;
+
+  /**
+   * \brief The number of rejected requests.
+   */
+  Poco::UInt64 rejected_requests_;
+};
+
+} // end namespace rws
+} // end namespace abb
+
+#endif
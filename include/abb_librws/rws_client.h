@@ -37,15 +37,19 @@
 #ifndef RWS_CLIENT_H
 #define RWS_CLIENT_H
 
-#include <deque>
+#include <functional>
+#include <future>
 #include <sstream>
 #include <vector>
 
 #include "Poco/DOM/DOMParser.h"
 
 #include "rws_common.h"
+#include "rws_executor.h"
+#include "rws_flight_recorder.h"
 #include "rws_rapid.h"
 #include "rws_poco_client.h"
+#include "rws_response_cache.h"
 
 namespace abb
 {
@@ -89,6 +93,53 @@ public:
      * \brief A default constructor.
      */
     RWSResult() : success(false) {}
+
+    /**
+     * \brief A copy constructor.
+     *
+     * \param other for the result to copy.
+     */
+    RWSResult(const RWSResult& other) = default;
+
+    /**
+     * \brief A move constructor.
+     *
+     * Note: The XML document is handed over without touching its (non-atomic) reference count, which makes it safe to
+     *       pass results between threads (e.g. from asynchronous operations).
+     *
+     * \param other for the result to move.
+     */
+    RWSResult(RWSResult&& other)
+    :
+    success(other.success),
+    error_message(std::move(other.error_message))
+    {
+      p_xml_document.swap(other.p_xml_document);
+    }
+
+    /**
+     * \brief A copy assignment operator.
+     *
+     * \param other for the result to copy.
+     *
+     * \return RWSResult& reference to this result.
+     */
+    RWSResult& operator=(const RWSResult& other) = default;
+
+    /**
+     * \brief A move assignment operator.
+     *
+     * \param other for the result to move.
+     *
+     * \return RWSResult& reference to this result.
+     */
+    RWSResult& operator=(RWSResult&& other)
+    {
+      success = other.success;
+      error_message = std::move(other.error_message);
+      p_xml_document.swap(other.p_xml_document);
+      return *this;
+    }
   };
 
   /**
@@ -196,6 +247,68 @@ public:
     std::string directory;
   };
 
+  /**
+   * \brief A struct for the configuration and the state of a resumable file download.
+   *
+   * The state (i.e. the offset, the length and the validator) is updated as the download proceeds. It can be kept,
+   * and used later on to continue an unfinished download into the same sink.
+   */
+  struct ResumableDownload
+  {
+    /**
+     * \brief A default constructor.
+     */
+    ResumableDownload()
+    :
+    chunk_size(DEFAULT_CHUNK_SIZE),
+    max_attempts(DEFAULT_MAX_ATTEMPTS),
+    offset(0),
+    length(-1)
+    {}
+
+    /**
+     * \brief A method for checking if the download has completed.
+     *
+     * \return bool indicating if the download has completed.
+     */
+    bool isComplete() const { return length >= 0 && offset >= static_cast<Poco::UInt64>(length); }
+
+    /**
+     * \brief The number of bytes [bytes] to request per HTTP GET request (zero for the rest of the file).
+     */
+    Poco::UInt64 chunk_size;
+
+    /**
+     * \brief The maximum number of consecutive attempts without progress, before the download is given up.
+     */
+    unsigned int max_attempts;
+
+    /**
+     * \brief The number of bytes [bytes] that have been written to the sink (i.e. the offset to continue from).
+     */
+    Poco::UInt64 offset;
+
+    /**
+     * \brief The file's length [bytes] (negative if not yet known).
+     */
+    Poco::Int64 length;
+
+    /**
+     * \brief The file's validator (i.e. entity tag or last modification date), for detecting changes in between.
+     */
+    std::string validator;
+
+    /**
+     * \brief Static constant for the default chunk size [bytes].
+     */
+    static const Poco::UInt64 DEFAULT_CHUNK_SIZE = 1024 * 1024;
+
+    /**
+     * \brief Static constant for the default maximum number of consecutive attempts without progress.
+     */
+    static const unsigned int DEFAULT_MAX_ATTEMPTS = 5;
+  };
+
   /**
    * \brief A class for representing subscription resources.
    */
@@ -290,6 +403,16 @@ public:
     ACTIVE ///< \brief Currently active coordinate.
   };
 
+  /**
+   * \brief A type for representing an operation that can be run asynchronously.
+   */
+  typedef std::function<RWSResult()> Operation;
+
+  /**
+   * \brief A type for representing a handler, which is called with the result of an asynchronous operation.
+   */
+  typedef std::function<void(const RWSResult& result)> CompletionHandler;
+
   /**
    * \brief A constructor.
    *
@@ -300,7 +423,9 @@ public:
   POCOClient(ip_address,
              SystemConstants::General::DEFAULT_PORT_NUMBER,
              SystemConstants::General::DEFAULT_USERNAME,
-             SystemConstants::General::DEFAULT_PASSWORD)
+             SystemConstants::General::DEFAULT_PASSWORD),
+  async_thread_pool_size_(Executor::DEFAULT_NUMBER_OF_THREADS),
+  logout_on_destruction_(true)
   {}
 
   /**
@@ -315,7 +440,9 @@ public:
   POCOClient(ip_address,
              SystemConstants::General::DEFAULT_PORT_NUMBER,
              username,
-             password)
+             password),
+  async_thread_pool_size_(Executor::DEFAULT_NUMBER_OF_THREADS),
+  logout_on_destruction_(true)
   {}
 
   /**
@@ -329,7 +456,9 @@ public:
   POCOClient(ip_address,
              port,
              SystemConstants::General::DEFAULT_USERNAME,
-             SystemConstants::General::DEFAULT_PASSWORD)
+             SystemConstants::General::DEFAULT_PASSWORD),
+  async_thread_pool_size_(Executor::DEFAULT_NUMBER_OF_THREADS),
+  logout_on_destruction_(true)
   {}
 
   /**
@@ -348,7 +477,9 @@ public:
   POCOClient(ip_address,
              port,
              username,
-             password)
+             password),
+  async_thread_pool_size_(Executor::DEFAULT_NUMBER_OF_THREADS),
+  logout_on_destruction_(true)
   {}
 
   /**
@@ -356,68 +487,98 @@ public:
    */
   ~RWSClient()
   {
-    logout();
+    // Complete any outstanding asynchronous operations before logging out.
+    p_executor_ = 0;
+
+    if (logout_on_destruction_)
+    {
+      logout();
+    }
   }
 
   /**
    * \brief Retrieves a list of controller resources (e.g. controller identity and clock information).
    *
+   * \param options for the request's options (e.g. a deadline).
+   *
    * \return RWSResult containing the result.
    */
-  RWSResult getContollerService();
+  RWSResult getContollerService(const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for retrieving the configuration instances of a type, belonging to a specific configuration topic.
    *
    * \param topic specifying the configuration topic.
    * \param type specifying the type in the configuration topic.
+   * \param options for the request's options (e.g. a deadline).
    *
    * \return RWSResult containing the result.
    */
-  RWSResult getConfigurationInstances(const std::string& topic, const std::string& type);
+  RWSResult getConfigurationInstances(const std::string& topic,
+                                      const std::string& type,
+                                      const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for retrieving all available IO signals on the controller.
    *
+   * \param options for the request's options (e.g. a deadline).
+   *
    * \return RWSResult containing the result.
    */
-  RWSResult getIOSignals();
+  RWSResult getIOSignals(const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for retrieving the value of an IO signal.
    *
    * \param iosignal for the IO signal's name.
+   * \param options for the request's options (e.g. a deadline).
    *
    * \return RWSResult containing the result.
    */
-  RWSResult getIOSignal(const std::string& iosignal);
+  RWSResult getIOSignal(const std::string& iosignal, const RequestOptions& options = RequestOptions());
+
+  /**
+   * \brief A method for retrieving the values of several IO signals in one burst.
+   *
+   * Note: The requests are pipelined if pipelining has been enabled (see POCOClient::setPipeliningEnabled(...)).
+   *
+   * \param iosignals for the IO signals' names.
+   * \param options for the requests' options (e.g. a deadline, which covers all of the requests).
+   *
+   * \return std::vector<RWSResult> containing the results (in the same order as the IO signals).
+   */
+  std::vector<RWSResult> getIOSignals(const std::vector<std::string>& iosignals,
+                                      const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for retrieving static information about a mechanical unit.
    *
    * \param mechunit for the mechanical unit's name.
+   * \param options for the request's options (e.g. a deadline).
    *
    * \return RWSResult containing the result.
    */
-  RWSResult getMechanicalUnitStaticInfo(const std::string& mechunit);
+  RWSResult getMechanicalUnitStaticInfo(const std::string& mechunit, const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for retrieving dynamic information about a mechanical unit.
    *
    * \param mechunit for the mechanical unit's name.
+   * \param options for the request's options (e.g. a deadline).
    *
    * \return RWSResult containing the result.
    */
-  RWSResult getMechanicalUnitDynamicInfo(const std::string& mechunit);
+  RWSResult getMechanicalUnitDynamicInfo(const std::string& mechunit, const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for retrieving the current jointtarget values of a mechanical unit.
    *
    * \param mechunit for the mechanical unit's name.
+   * \param options for the request's options (e.g. a deadline).
    *
    * \return RWSResult containing the result.
    */
-  RWSResult getMechanicalUnitJointTarget(const std::string& mechunit);
+  RWSResult getMechanicalUnitJointTarget(const std::string& mechunit, const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for retrieving the current robtarget values of a mechanical unit.
@@ -426,157 +587,209 @@ public:
    * \param coordinate for the coordinate mode (base, world, tool, or wobj) in which the robtarget will be reported.
    * \param tool for the tool frame relative to which the robtarget will be reported.
    * \param wobj for the work object (wobj) relative to which the robtarget will be reported.
+   * \param options for the request's options (e.g. a deadline).
    *
    * \return RWSResult containing the result.
    */
   RWSResult getMechanicalUnitRobTarget(const std::string& mechunit,
                                        const Coordinate& coordinate = ACTIVE,
                                        const std::string& tool = "",
-                                       const std::string& wobj = "");
+                                       const std::string& wobj = "",
+                                       const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for retrieving the data of a RAPID symbol.
    *
    * \param resource specifying the RAPID task, module and symbol names for the RAPID resource.
+   * \param options for the request's options (e.g. a deadline).
    *
    * \return RWSResult containing the result.
    */
-  RWSResult getRAPIDSymbolData(const RAPIDResource& resource);
+  RWSResult getRAPIDSymbolData(const RAPIDResource& resource, const RequestOptions& options = RequestOptions());
+
+  /**
+   * \brief A method for retrieving the data of several RAPID symbols in one burst.
+   *
+   * Note: The requests are pipelined if pipelining has been enabled (see POCOClient::setPipeliningEnabled(...)).
+   *
+   * \param resources specifying the RAPID task, module and symbol names for the RAPID resources.
+   * \param options for the requests' options (e.g. a deadline, which covers all of the requests).
+   *
+   * \return std::vector<RWSResult> containing the results (in the same order as the RAPID resources).
+   */
+  std::vector<RWSResult> getRAPIDSymbolsData(const std::vector<RAPIDResource>& resources,
+                                             const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for retrieving the data of a RAPID symbol (parsed into a struct representing the RAPID data).
    *
    * \param resource specifying the RAPID task, module and symbol names for the RAPID resource.
    * \param p_data for containing the retrieved data.
+   * \param options for the requests' options (e.g. a deadline, which covers all of the requests).
    *
    * \return RWSResult containing the result.
    */
-  RWSResult getRAPIDSymbolData(const RAPIDResource& resource, RAPIDSymbolDataAbstract* p_data);
+  RWSResult getRAPIDSymbolData(const RAPIDResource& resource,
+                               RAPIDSymbolDataAbstract* p_data,
+                               const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for retrieving the properties of a RAPID symbol.
    *
    * \param resource specifying the RAPID task, module and symbol names for the RAPID resource.
+   * \param options for the request's options (e.g. a deadline).
    *
    * \return RWSResult containing the result.
    */
-  RWSResult getRAPIDSymbolProperties(const RAPIDResource& resource);
+  RWSResult getRAPIDSymbolProperties(const RAPIDResource& resource, const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for retrieving the execution state of RAPID.
    *
+   * \param options for the request's options (e.g. a deadline).
+   *
    * \return RWSResult containing the result.
    */
-  RWSResult getRAPIDExecution();
+  RWSResult getRAPIDExecution(const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for retrieving information about the RAPID modules of a RAPID task.
    *
    * \param task specifying the RAPID task.
+   * \param options for the request's options (e.g. a deadline).
    *
    * \return RWSResult containing the result.
    */
-  RWSResult getRAPIDModulesInfo(const std::string& task);
+  RWSResult getRAPIDModulesInfo(const std::string& task, const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for retrieving the RAPID tasks that are defined in the robot controller system.
    *
+   * \param options for the request's options (e.g. a deadline).
+   *
    * \return RWSResult containing the result.
    */
-  RWSResult getRAPIDTasks();
+  RWSResult getRAPIDTasks(const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for retrieving info about the current robot controller system.
    *
+   * \param options for the request's options (e.g. a deadline).
+   *
    * \return RWSResult containing the result.
    */
-  RWSResult getRobotWareSystem();
+  RWSResult getRobotWareSystem(const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for retrieving the robot controller's speed ratio for RAPID motions (e.g. MoveJ and MoveL).
    *
+   * \param options for the request's options (e.g. a deadline).
+   *
    * \return RWSResult containing the result.
    */
-  RWSResult getSpeedRatio();
+  RWSResult getSpeedRatio(const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for retrieving the controller state.
    *
+   * \param options for the request's options (e.g. a deadline).
+   *
    * \return RWSResult containing the result.
    */
-  RWSResult getPanelControllerState();
+  RWSResult getPanelControllerState(const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for retrieving the operation mode of the controller.
    *
+   * \param options for the request's options (e.g. a deadline).
+   *
    * \return RWSResult containing the result.
    */
-  RWSResult getPanelOperationMode();
+  RWSResult getPanelOperationMode(const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for setting the value of an IO signal.
    *
    * \param iosignal for the IO signal's name.
    * \param value for the IO signal's new value.
+   * \param options for the request's options (e.g. a deadline).
    *
    * \return RWSResult containing the result.
    */
-  RWSResult setIOSignal(const std::string& iosignal, const std::string& value);
+  RWSResult setIOSignal(const std::string& iosignal,
+                        const std::string& value,
+                        const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for setting the data of a RAPID symbol.
    *
    * \param resource specifying the RAPID task, module and symbol names for the RAPID resource.
    * \param data for the RAPID symbol's new data.
+   * \param options for the request's options (e.g. a deadline).
    *
    * \return RWSResult containing the result.
    */
-  RWSResult setRAPIDSymbolData(const RAPIDResource& resource, const std::string& data);
+  RWSResult setRAPIDSymbolData(const RAPIDResource& resource,
+                               const std::string& data,
+                               const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for setting the data of a RAPID symbol (based on the provided struct representing the RAPID data).
    *
    * \param resource specifying the RAPID task, module and symbol names for the RAPID resource.
    * \param data for the RAPID symbol's new data.
+   * \param options for the request's options (e.g. a deadline).
    *
    * \return RWSResult containing the result.
    */
-  RWSResult setRAPIDSymbolData(const RAPIDResource& resource, const RAPIDSymbolDataAbstract& data);
+  RWSResult setRAPIDSymbolData(const RAPIDResource& resource,
+                               const RAPIDSymbolDataAbstract& data,
+                               const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for starting RAPID execution in the robot controller.
    *
+   * \param options for the request's options (e.g. a deadline).
+   *
    * \return RWSResult containing the result.
    */
-  RWSResult startRAPIDExecution();
+  RWSResult startRAPIDExecution(const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for stopping RAPID execution in the robot controller.
    *
+   * \param options for the request's options (e.g. a deadline).
+   *
    * \return RWSResult containing the result.
    */
-  RWSResult stopRAPIDExecution();
+  RWSResult stopRAPIDExecution(const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for reseting the RAPID program pointer in the robot controller.
    *
+   * \param options for the request's options (e.g. a deadline).
+   *
    * \return RWSResult containing the result.
    */
-  RWSResult resetRAPIDProgramPointer();
+  RWSResult resetRAPIDProgramPointer(const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for turning on the robot controller's motors.
    *
+   * \param options for the request's options (e.g. a deadline).
+   *
    * \return RWSResult containing the result.
    */
-  RWSResult setMotorsOn();
+  RWSResult setMotorsOn(const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for turning off the robot controller's motors.
    *
+   * \param options for the request's options (e.g. a deadline).
+   *
    * \return RWSResult containing the result.
    */
-  RWSResult setMotorsOff();
+  RWSResult setMotorsOff(const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for setting the robot controller's speed ratio for RAPID motions (e.g. MoveJ and MoveL).
@@ -584,13 +797,14 @@ public:
    * Note: The ratio must be an integer in the range [0, 100] (ie: inclusive).
    *
    * \param ratio specifying the new ratio.
+   * \param options for the request's options (e.g. a deadline).
    *
    * \return RWSResult containing the result.
    *
    * \throw std::out_of_range if argument is out of range.
    * \throw std::runtime_error if failed to create a string from the argument.
    */
-  RWSResult setSpeedRatio(unsigned int ratio);
+  RWSResult setSpeedRatio(unsigned int ratio, const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for retrieving a file from the robot controller.
@@ -599,38 +813,121 @@ public:
    *
    * \param resource specifying the file's directory and name.
    * \param p_file_content for containing the retrieved file content.
+   * \param options for the request's options (e.g. a deadline).
    *
    * \return RWSResult containing the result.
    */
-  RWSResult getFile(const FileResource& resource, std::string* p_file_content);
+  RWSResult getFile(const FileResource& resource,
+                    std::string* p_file_content,
+                    const RequestOptions& options = RequestOptions());
+
+  /**
+   * \brief A method for retrieving a file from the robot controller, and for streaming it into a sink.
+   *
+   * The file is transferred in chunks, i.e. the memory usage is bounded regardless of the file's size. Use e.g. a
+   * StreamContentSink to write the file to a std::ofstream, a FileDescriptorContentSink to write it to a file
+   * descriptor, or a CallbackContentSink to process it on the fly. The progress can be reported via the options.
+   *
+   * \param resource specifying the file's directory and name.
+   * \param sink for the sink to write the file's content to.
+   * \param options for the request's options (e.g. a deadline, or a progress handler).
+   *
+   * \return RWSResult containing the result.
+   */
+  RWSResult getFile(const FileResource& resource, ContentSink& sink, const RequestOptions& options = RequestOptions());
+
+  /**
+   * \brief A method for retrieving a file from the robot controller with resumable (HTTP Range) requests.
+   *
+   * The file is requested in chunks (see ResumableDownload::chunk_size). If a request fails midway (e.g. due to a
+   * dropped connection), then the download continues from the last byte that was written to the sink, instead of
+   * restarting from the beginning. The file's validator is checked for each chunk, so that the pieces of different
+   * versions of the file are never combined. If the server ignores the ranges, then the already received bytes are
+   * discarded from its responses (i.e. the download still completes, but less efficiently).
+   *
+   * Note: The download is given up if the file has changed, if the sink aborts the transfer, if the server responds
+   *       with an error, or after too many consecutive attempts without progress. The download's state can then be
+   *       used to continue it later on (unless the file has changed).
+   *
+   * \param resource specifying the file's directory and name.
+   * \param sink for the sink to write the file's content to (it receives the content after the download's offset).
+   * \param download for the download's configuration and state.
+   * \param options for the requests' options (e.g. a deadline for the complete download, or a progress handler).
+   *
+   * \return RWSResult containing the result.
+   */
+  RWSResult getFile(const FileResource& resource,
+                    ContentSink& sink,
+                    ResumableDownload& download,
+                    const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for uploading a file to the robot controller.
    *
    * \param resource specifying the file's directory and name.
    * \param file_content for the file's content.
+   * \param options for the request's options (e.g. a deadline).
    *
    * \return RWSResult containing the result.
    */
-  RWSResult uploadFile(const FileResource& resource, const std::string& file_content);
+  RWSResult uploadFile(const FileResource& resource,
+                       const std::string& file_content,
+                       const RequestOptions& options = RequestOptions());
+
+  /**
+   * \brief A method for uploading a file to the robot controller, with its content streamed from a source.
+   *
+   * The file is transferred in chunks, i.e. it is neither copied nor retained in the result. Use e.g. a
+   * MappedFileContentSource to upload a local file (memory-mapped), a StreamContentSource to upload from a
+   * std::istream, or a CallbackContentSource to produce the content on the fly. The progress can be reported via the
+   * options.
+   *
+   * Note: Sources that cannot be rewound (e.g. a CallbackContentSource without a rewinder) cannot be resent after an
+   *       authentication challenge. Authenticate beforehand (e.g. by any other request) in that case.
+   *
+   * \param resource specifying the file's directory and name.
+   * \param source for the source to read the file's content from.
+   * \param options for the request's options (e.g. a deadline, or a progress handler).
+   *
+   * \return RWSResult containing the result.
+   */
+  RWSResult uploadFile(const FileResource& resource,
+                       ContentSource& source,
+                       const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for deleting a file from the robot controller.
    *
    * \param resource specifying the file's directory and name.
+   * \param options for the request's options (e.g. a deadline).
+   *
+   * \return RWSResult containing the result.
+   */
+  RWSResult deleteFile(const FileResource& resource, const RequestOptions& options = RequestOptions());
+
+  /**
+   * \brief A method for listing a directory on the robot controller.
+   *
+   * The listing contains one list item per entry, with the class "fs-dir" (for subdirectories) or "fs-file" (for
+   * files). An item's "title" attribute holds the entry's name, and a file's item holds its size ("fs-size") and
+   * modification date ("fs-mdate").
+   *
+   * \param directory for the directory (e.g. "$home" or "$home/logs").
+   * \param options for the request's options (e.g. a deadline).
    *
    * \return RWSResult containing the result.
    */
-  RWSResult deleteFile(const FileResource& resource);
+  RWSResult getDirectoryListing(const std::string& directory, const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for starting for a subscription.
    *
    * \param resources specifying the resources to subscribe to.
+   * \param options for the subscription request's options (e.g. a deadline).
    *
    * \return RWSResult containing the result.
    */
-  RWSResult startSubscription(const SubscriptionResources& resources);
+  RWSResult startSubscription(const SubscriptionResources& resources, const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for waiting for a subscription event.
@@ -642,9 +939,11 @@ public:
   /**
    * \brief A method for ending a active subscription.
    *
+   * \param options for the request's options (e.g. a deadline).
+   *
    * \return RWSResult containing the result.
    */
-  RWSResult endSubscription();
+  RWSResult endSubscription(const RequestOptions& options = RequestOptions());
 
   /**
    * \brief Force close the active subscription connection.
@@ -664,9 +963,11 @@ public:
   /**
    * \brief A method for logging out the currently active RWS session.
    *
+   * \param options for the request's options (e.g. a deadline).
+   *
    * \return RWSResult containing the result.
    */
-  RWSResult logout();
+  RWSResult logout(const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for registering a user as local.
@@ -674,12 +975,14 @@ public:
    * \param username specifying the user name.
    * \param application specifying the external application.
    * \param location specifying the location.
+   * \param options for the request's options (e.g. a deadline).
    *
    * \return RWSResult containing the result.
    */
   RWSResult registerLocalUser(const std::string& username = SystemConstants::General::DEFAULT_USERNAME,
                               const std::string& application = SystemConstants::General::EXTERNAL_APPLICATION,
-                              const std::string& location = SystemConstants::General::EXTERNAL_LOCATION);
+                              const std::string& location = SystemConstants::General::EXTERNAL_LOCATION,
+                              const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for registering a user as remote.
@@ -687,12 +990,14 @@ public:
    * \param username specifying the user name.
    * \param application specifying the external application.
    * \param location specifying the location.
+   * \param options for the request's options (e.g. a deadline).
    *
    * \return RWSResult containing the result.
    */
   RWSResult registerRemoteUser(const std::string& username = SystemConstants::General::DEFAULT_USERNAME,
                                const std::string& application = SystemConstants::General::EXTERNAL_APPLICATION,
-                               const std::string& location = SystemConstants::General::EXTERNAL_LOCATION);
+                               const std::string& location = SystemConstants::General::EXTERNAL_LOCATION,
+                               const RequestOptions& options = RequestOptions());
 
   /**
    * \brief Method for parsing a communication result into a XML document.
@@ -720,6 +1025,525 @@ public:
    */
   std::string getLogTextLatestEvent(const bool verbose = false);
 
+  /**
+   * \brief Method for setting the internal log's verbosity, i.e. if (truncated) response contents should be captured.
+   *
+   * \param verbosity for the verbosity.
+   */
+  void setLogVerbosity(const FlightRecorder::Verbosity verbosity) { flight_recorder_.setVerbosity(verbosity); }
+
+  /**
+   * \brief Method for accessing the internal log's flight recorder, e.g. for retrieving the raw records.
+   *
+   * \return const FlightRecorder& referring to the flight recorder.
+   */
+  const FlightRecorder& getFlightRecorder() const { return flight_recorder_; }
+
+  /**
+   * \brief Method for accessing the cache for static, or slowly changing, resources (e.g. for configuring TTLs).
+   *
+   * Note: The cache is disabled by default. It should be invalidated if the controller is restarted or reconfigured.
+   *
+   * \return ResponseCache& referring to the cache.
+   */
+  ResponseCache& getResponseCache() { return response_cache_; }
+
+  /**
+   * \brief A method for setting if the client should log out from the controller when it is destroyed.
+   *
+   * Disable this (e.g. together with a session store) to keep the session alive for other, or later, clients.
+   *
+   * \param logout for indicating if the client should log out or not.
+   */
+  void setLogoutOnDestruction(const bool logout) { logout_on_destruction_ = logout; }
+
+  /**
+   * \brief A method for running an operation asynchronously, on the client's executor.
+   *
+   * Note: Operations are queued, and run concurrently up to the size of the executor's thread pool (and are further
+   *       limited by the size of the connection pool).
+   *
+   * \param operation for the operation to run.
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result. Any exception thrown by the operation is rethrown by it.
+   */
+  std::future<RWSResult> runAsync(const Operation& operation, const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief A method for setting the number of threads used for running asynchronous operations.
+   *
+   * Note: If the executor has already been started, then this method waits for all queued operations to complete
+   *       (so it must not be called from a completion handler).
+   *
+   * \param size for the number of threads.
+   */
+  void setAsyncThreadPoolSize(const size_t size);
+
+  /**
+   * \brief Asynchronous variant of getContollerService().
+   *
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> getContollerServiceAsync(const RequestOptions& options = RequestOptions(),
+                                                  const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of getConfigurationInstances(...).
+   *
+   * \param topic specifying the configuration topic.
+   * \param type specifying the type in the configuration topic.
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> getConfigurationInstancesAsync(const std::string& topic,
+                                                        const std::string& type,
+                                                        const RequestOptions& options = RequestOptions(),
+                                                        const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of getIOSignals().
+   *
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> getIOSignalsAsync(const RequestOptions& options = RequestOptions(),
+                                           const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of getIOSignal(...).
+   *
+   * \param iosignal for the IO signal's name.
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> getIOSignalAsync(const std::string& iosignal,
+                                          const RequestOptions& options = RequestOptions(),
+                                          const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of getMechanicalUnitStaticInfo(...).
+   *
+   * \param mechunit for the mechanical unit's name.
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> getMechanicalUnitStaticInfoAsync(const std::string& mechunit,
+                                                          const RequestOptions& options = RequestOptions(),
+                                                          const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of getMechanicalUnitDynamicInfo(...).
+   *
+   * \param mechunit for the mechanical unit's name.
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> getMechanicalUnitDynamicInfoAsync(const std::string& mechunit,
+                                                           const RequestOptions& options = RequestOptions(),
+                                                           const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of getMechanicalUnitJointTarget(...).
+   *
+   * \param mechunit for the mechanical unit's name.
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> getMechanicalUnitJointTargetAsync(const std::string& mechunit,
+                                                           const RequestOptions& options = RequestOptions(),
+                                                           const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of getMechanicalUnitRobTarget(...).
+   *
+   * \param mechunit for the mechanical unit's name.
+   * \param coordinate for the coordinate mode (base, world, tool, or wobj) in which the robtarget will be reported.
+   * \param tool for the tool frame relative to which the robtarget will be reported.
+   * \param wobj for the work object (wobj) relative to which the robtarget will be reported.
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> getMechanicalUnitRobTargetAsync(const std::string& mechunit,
+                                                         const Coordinate& coordinate = ACTIVE,
+                                                         const std::string& tool = "",
+                                                         const std::string& wobj = "",
+                                                         const RequestOptions& options = RequestOptions(),
+                                                         const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of getRAPIDSymbolData(...).
+   *
+   * \param resource specifying the RAPID task, module and symbol names for the RAPID resource.
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> getRAPIDSymbolDataAsync(const RAPIDResource& resource,
+                                                 const RequestOptions& options = RequestOptions(),
+                                                 const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of getRAPIDSymbolData(...) (parsed into a struct representing the RAPID data).
+   *
+   * \param resource specifying the RAPID task, module and symbol names for the RAPID resource.
+   * \param p_data for containing the retrieved data (must outlive the operation).
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> getRAPIDSymbolDataAsync(const RAPIDResource& resource,
+                                                 RAPIDSymbolDataAbstract* p_data,
+                                                 const RequestOptions& options = RequestOptions(),
+                                                 const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of getRAPIDSymbolProperties(...).
+   *
+   * \param resource specifying the RAPID task, module and symbol names for the RAPID resource.
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> getRAPIDSymbolPropertiesAsync(const RAPIDResource& resource,
+                                                       const RequestOptions& options = RequestOptions(),
+                                                       const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of getRAPIDExecution().
+   *
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> getRAPIDExecutionAsync(const RequestOptions& options = RequestOptions(),
+                                                const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of getRAPIDModulesInfo(...).
+   *
+   * \param task specifying the RAPID task.
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> getRAPIDModulesInfoAsync(const std::string& task,
+                                                  const RequestOptions& options = RequestOptions(),
+                                                  const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of getRAPIDTasks().
+   *
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> getRAPIDTasksAsync(const RequestOptions& options = RequestOptions(),
+                                            const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of getRobotWareSystem().
+   *
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> getRobotWareSystemAsync(const RequestOptions& options = RequestOptions(),
+                                                 const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of getSpeedRatio().
+   *
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> getSpeedRatioAsync(const RequestOptions& options = RequestOptions(),
+                                            const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of getPanelControllerState().
+   *
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> getPanelControllerStateAsync(const RequestOptions& options = RequestOptions(),
+                                                      const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of getPanelOperationMode().
+   *
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> getPanelOperationModeAsync(const RequestOptions& options = RequestOptions(),
+                                                    const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of setIOSignal(...).
+   *
+   * \param iosignal for the IO signal's name.
+   * \param value for the IO signal's new value.
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> setIOSignalAsync(const std::string& iosignal,
+                                          const std::string& value,
+                                          const RequestOptions& options = RequestOptions(),
+                                          const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of setRAPIDSymbolData(...).
+   *
+   * \param resource specifying the RAPID task, module and symbol names for the RAPID resource.
+   * \param data for the RAPID symbol's new data.
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> setRAPIDSymbolDataAsync(const RAPIDResource& resource,
+                                                 const std::string& data,
+                                                 const RequestOptions& options = RequestOptions(),
+                                                 const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of setRAPIDSymbolData(...) (based on the provided struct representing the RAPID data).
+   *
+   * \param resource specifying the RAPID task, module and symbol names for the RAPID resource.
+   * \param data for the RAPID symbol's new data (converted to a string before the method returns).
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> setRAPIDSymbolDataAsync(const RAPIDResource& resource,
+                                                 const RAPIDSymbolDataAbstract& data,
+                                                 const RequestOptions& options = RequestOptions(),
+                                                 const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of startRAPIDExecution().
+   *
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> startRAPIDExecutionAsync(const RequestOptions& options = RequestOptions(),
+                                                  const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of stopRAPIDExecution().
+   *
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> stopRAPIDExecutionAsync(const RequestOptions& options = RequestOptions(),
+                                                 const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of resetRAPIDProgramPointer().
+   *
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> resetRAPIDProgramPointerAsync(const RequestOptions& options = RequestOptions(),
+                                                       const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of setMotorsOn().
+   *
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> setMotorsOnAsync(const RequestOptions& options = RequestOptions(),
+                                          const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of setMotorsOff().
+   *
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> setMotorsOffAsync(const RequestOptions& options = RequestOptions(),
+                                           const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of setSpeedRatio(...). Exceptions are delivered through the returned future.
+   *
+   * \param ratio specifying the new ratio.
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> setSpeedRatioAsync(unsigned int ratio,
+                                            const RequestOptions& options = RequestOptions(),
+                                            const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of getFile(...).
+   *
+   * \param resource specifying the file's directory and name.
+   * \param p_file_content for containing the retrieved file content (must outlive the operation).
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> getFileAsync(const FileResource& resource,
+                                      std::string* p_file_content,
+                                      const RequestOptions& options = RequestOptions(),
+                                      const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of uploadFile(...).
+   *
+   * \param resource specifying the file's directory and name.
+   * \param file_content for the file's content.
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> uploadFileAsync(const FileResource& resource,
+                                         const std::string& file_content,
+                                         const RequestOptions& options = RequestOptions(),
+                                         const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of deleteFile(...).
+   *
+   * \param resource specifying the file's directory and name.
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> deleteFileAsync(const FileResource& resource,
+                                         const RequestOptions& options = RequestOptions(),
+                                         const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of startSubscription(...).
+   *
+   * \param resources specifying the resources to subscribe to.
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> startSubscriptionAsync(const SubscriptionResources& resources,
+                                                const RequestOptions& options = RequestOptions(),
+                                                const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of waitForSubscriptionEvent().
+   *
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> waitForSubscriptionEventAsync(const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of endSubscription().
+   *
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> endSubscriptionAsync(const RequestOptions& options = RequestOptions(),
+                                              const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of logout().
+   *
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult> logoutAsync(const RequestOptions& options = RequestOptions(),
+                                     const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of registerLocalUser(...).
+   *
+   * \param username specifying the user name.
+   * \param application specifying the external application.
+   * \param location specifying the location.
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult>
+  registerLocalUserAsync(const std::string& username = SystemConstants::General::DEFAULT_USERNAME,
+                         const std::string& application = SystemConstants::General::EXTERNAL_APPLICATION,
+                         const std::string& location = SystemConstants::General::EXTERNAL_LOCATION,
+                         const RequestOptions& options = RequestOptions(),
+                         const CompletionHandler& handler = CompletionHandler());
+
+  /**
+   * \brief Asynchronous variant of registerRemoteUser(...).
+   *
+   * \param username specifying the user name.
+   * \param application specifying the external application.
+   * \param location specifying the location.
+   * \param options for the request's options (e.g. a deadline).
+   * \param handler for an optional completion handler, called (from an executor thread) with the result.
+   *
+   * \return std::future<RWSResult> for retrieving the result.
+   */
+  std::future<RWSResult>
+  registerRemoteUserAsync(const std::string& username = SystemConstants::General::DEFAULT_USERNAME,
+                          const std::string& application = SystemConstants::General::EXTERNAL_APPLICATION,
+                          const std::string& location = SystemConstants::General::EXTERNAL_LOCATION,
+                          const RequestOptions& options = RequestOptions(),
+                          const CompletionHandler& handler = CompletionHandler());
+
 private:
   /**
    * \brief A struct for representing conditions, for the evaluation of an attempted RWS communication.
@@ -770,6 +1594,32 @@ private:
    */
   RWSResult evaluatePOCOResult(const POCOResult& poco_result, const EvaluationConditions& conditions);
 
+  /**
+   * \brief Method for evaluating the results from a burst of POCO communications.
+   *
+   * \param poco_results for the POCO results to evaluate.
+   * \param conditions specifying the conditions for the evaluation (applied to each result).
+   *
+   * \return std::vector<RWSResult> containing the evaluated results.
+   */
+  std::vector<RWSResult> evaluatePOCOResults(const std::vector<POCOResult>& poco_results,
+                                             const EvaluationConditions& conditions);
+
+  /**
+   * \brief Method for retrieving a cacheable resource, i.e. it is only requested if the cache has no valid entry.
+   *
+   * \param resource_class for the resource's class (which decides the cache entry's time to live).
+   * \param uri for the resource's URI.
+   * \param options for the request's options (only used if the resource is requested).
+   * \param conditions specifying the conditions for the evaluation.
+   *
+   * \return RWSResult containing the evaluated (or cached) result.
+   */
+  RWSResult getCacheable(const ResponseCache::ResourceClass resource_class,
+                         const std::string& uri,
+                         const RequestOptions& options,
+                         const EvaluationConditions& conditions);
+
   /**
    * \brief Method for generating a configuration URI path.
    *
@@ -826,9 +1676,14 @@ private:
   std::string generateFilePath(const FileResource& resource);
 
   /**
-   * \brief Static constant for the log's size.
+   * \brief Method for applying a default priority to request options (unless a priority has been set explicitly).
+   *
+   * \param options for the request options.
+   * \param priority for the default priority.
+   *
+   * \return RequestOptions containing the options with the priority applied.
    */
-  static const size_t LOG_SIZE = 20;
+  static RequestOptions withPriority(const RequestOptions& options, const RequestOptions::Priority priority);
 
   /**
    * \brief Static constant for the default RWS subscription timeout [microseconds].
@@ -836,14 +1691,46 @@ private:
   static const Poco::Int64 DEFAULT_SUBSCRIPTION_TIMEOUT = 40e6;
 
   /**
-   * \brief Container for logging communication results.
+   * \brief Flight recorder for logging communication results (safe to write from concurrent requests).
    */
-  std::deque<POCOResult> log_;
+  FlightRecorder flight_recorder_;
+
+  /**
+   * \brief Cache for the parsed responses of static, or slowly changing, resources.
+   */
+  ResponseCache response_cache_;
 
   /**
    * \brief A subscription group id.
    */
   std::string subscription_group_id_;
+
+  /**
+   * \brief A method for retrieving the executor used for asynchronous operations (it is started on first use).
+   *
+   * \return Poco::SharedPtr<Executor> containing the executor.
+   */
+  Poco::SharedPtr<Executor> getExecutor();
+
+  /**
+   * \brief A mutex for protecting the executor pointer.
+   */
+  Poco::Mutex executor_mutex_;
+
+  /**
+   * \brief The number of threads used for running asynchronous operations.
+   */
+  size_t async_thread_pool_size_;
+
+  /**
+   * \brief The executor used for running asynchronous operations.
+   */
+  Poco::SharedPtr<Executor> p_executor_;
+
+  /**
+   * \brief Flag indicating if the client should log out when it is destroyed.
+   */
+  bool logout_on_destruction_;
 };
 
 } // end namespace rws
@@ -447,6 +447,26 @@ struct SystemConstants
        */
       static const XMLAttribute CLASS_EXCSTATE;
 
+      /**
+       * \brief Class & fs-dir.
+       */
+      static const XMLAttribute CLASS_FS_DIR;
+
+      /**
+       * \brief Class & fs-file.
+       */
+      static const XMLAttribute CLASS_FS_FILE;
+
+      /**
+       * \brief Class & fs-mdate.
+       */
+      static const XMLAttribute CLASS_FS_MDATE;
+
+      /**
+       * \brief Class & fs-size.
+       */
+      static const XMLAttribute CLASS_FS_SIZE;
+
       /**
        * \brief Class & ios-signal.
        */
@@ -573,6 +593,26 @@ struct SystemConstants
        */
       static const std::string EXCSTATE;
 
+      /**
+       * \brief File service directory list item.
+       */
+      static const std::string FS_DIR;
+
+      /**
+       * \brief File service file list item.
+       */
+      static const std::string FS_FILE;
+
+      /**
+       * \brief File service modification date.
+       */
+      static const std::string FS_MDATE;
+
+      /**
+       * \brief File service file size.
+       */
+      static const std::string FS_SIZE;
+
       /**
        * \brief Home directory.
        */
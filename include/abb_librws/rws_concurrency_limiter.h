@@ -0,0 +1,288 @@
+/***********************************************************************************************************************
+ *
+ * Copyright (c) 2026, ABB Schweiz AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with
+ * or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer in the documentation
+ *      and/or other materials provided with the
+ *      distribution.
+ *    * Neither the name of ABB nor the names of its
+ *      contributors may be used to endorse or promote
+ *      products derived from this software without
+ *      specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ***********************************************************************************************************************
+ */
+
+#ifndef RWS_CONCURRENCY_LIMITER_H
+#define RWS_CONCURRENCY_LIMITER_H
+
+#include <map>
+#include <string>
+
+#include "Poco/Condition.h"
+#include "Poco/Mutex.h"
+#include "Poco/SharedPtr.h"
+#include "Poco/Timestamp.h"
+
+#include "rws_cancellation_token.h"
+
+namespace abb
+{
+namespace rws
+{
+/**
+ * \brief A class for adaptively limiting the number of concurrent requests to a controller (AIMD).
+ *
+ * The limit grows additively (by one request per limit's worth of successful requests, i.e. roughly by one per
+ * round trip), while it is being used. It is cut multiplicatively when the controller shows signs of overload, i.e.
+ * HTTP 503 (Service Unavailable) or 429 (Too Many Requests) responses, timeouts, or round-trip times that rise well
+ * above their baseline. At most one cut is made per decrease interval, so that a burst of failures counts once.
+ *
+ * Limiters are shared per controller (see getInstance(...)), so that all clients to the same controller converge on
+ * the highest sustainable concurrency together.
+ */
+class ConcurrencyLimiter
+{
+public:
+  /**
+   * \brief An enum for the outcomes of requests.
+   */
+  enum Outcome
+  {
+    SUCCESS,  ///< The controller handled the request.
+    OVERLOAD, ///< The controller showed signs of overload (e.g. HTTP 503, or a timeout).
+    IGNORED   ///< The outcome says nothing about the controller's load (e.g. a cancelled request).
+  };
+
+  /**
+   * \brief A struct for containing the limiter's configuration.
+   */
+  struct Configuration
+  {
+    /**
+     * \brief The initial limit [requests].
+     */
+    double initial_limit;
+
+    /**
+     * \brief The lowest limit [requests].
+     */
+    double min_limit;
+
+    /**
+     * \brief The highest limit [requests].
+     */
+    double max_limit;
+
+    /**
+     * \brief Factor that the limit is multiplied with on overload (in the range (0, 1)).
+     */
+    double decrease_factor;
+
+    /**
+     * \brief The shortest time between two cuts of the limit [microseconds].
+     */
+    Poco::Int64 decrease_interval;
+
+    /**
+     * \brief Factor that a smoothed round-trip time must exceed its baseline with, to count as overload (zero to
+     *        ignore round-trip times).
+     */
+    double latency_tolerance;
+
+    /**
+     * \brief Number of round-trip times an endpoint class needs, before its round-trip times are evaluated.
+     */
+    unsigned int min_samples;
+
+    /**
+     * \brief A default constructor.
+     */
+    Configuration()
+    :
+    initial_limit(4.0),
+    min_limit(1.0),
+    max_limit(32.0),
+    decrease_factor(0.5),
+    decrease_interval(100000),
+    latency_tolerance(3.0),
+    min_samples(10)
+    {}
+  };
+
+  /**
+   * \brief A constructor.
+   *
+   * \param configuration for the limiter's configuration.
+   */
+  explicit ConcurrencyLimiter(const Configuration& configuration = Configuration());
+
+  /**
+   * \brief A method for acquiring a permit for a request. Blocks until the number of requests is below the limit.
+   *
+   * If true is returned, then the outcome must be reported with release(...).
+   *
+   * \param timeout for the maximum time to wait [microseconds] (negative to wait without a timeout).
+   * \param p_cancellation_token for an optional token, which ends the wait when cancelled.
+   *
+   * \return bool indicating if a permit was acquired.
+   */
+  bool acquire(const Poco::Int64 timeout,
+               const Poco::SharedPtr<CancellationToken>& p_cancellation_token = Poco::SharedPtr<CancellationToken>());
+
+  /**
+   * \brief A method for releasing a permit, and for reporting the request's outcome.
+   *
+   * \param outcome for the request's outcome.
+   * \param endpoint_class for the request's endpoint class (see AdaptiveTimeout::classify(...)).
+   * \param latency for the request's round-trip time [microseconds] (negative if it should not be evaluated, e.g.
+   *                for streamed transfers).
+   */
+  void release(const Outcome outcome, const std::string& endpoint_class = "", const Poco::Int64 latency = -1);
+
+  /**
+   * \brief A method for retrieving the current limit.
+   *
+   * \return double containing the limit [requests] (requests are admitted while fewer than floor(limit) are active).
+   */
+  double getLimit();
+
+  /**
+   * \brief A method for retrieving the number of active requests.
+   *
+   * \return size_t containing the number of requests.
+   */
+  size_t getNumberOfActiveRequests();
+
+  /**
+   * \brief A method for retrieving the number of times the limit has been cut.
+   *
+   * \return Poco::UInt64 containing the number of cuts.
+   */
+  Poco::UInt64 getNumberOfDecreases();
+
+  /**
+   * \brief A method for retrieving the (process wide) limiter for a controller.
+   *
+   * \param ip_address for the controller's IP address.
+   * \param port for the controller's port.
+   *
+   * \return Poco::SharedPtr<ConcurrencyLimiter> for the limiter.
+   */
+  static Poco::SharedPtr<ConcurrencyLimiter> getInstance(const std::string& ip_address, const Poco::UInt16 port);
+
+private:
+  /**
+   * \brief A struct for containing the round-trip time statistics of an endpoint class.
+   */
+  struct LatencyStatistics
+  {
+    /**
+     * \brief A default constructor.
+     */
+    LatencyStatistics() : baseline(0.0), smoothed(0.0), samples(0) {}
+
+    /**
+     * \brief The baseline round-trip time [microseconds], i.e. a slowly rising minimum.
+     */
+    double baseline;
+
+    /**
+     * \brief The smoothed round-trip time [microseconds].
+     */
+    double smoothed;
+
+    /**
+     * \brief The number of observed round-trip times.
+     */
+    unsigned int samples;
+  };
+
+  /**
+   * \brief A method for checking if a round-trip time indicates overload.
+   *
+   * Note: The limiter's mutex must be held by the caller.
+   *
+   * \param endpoint_class for the request's endpoint class.
+   * \param latency for the request's round-trip time [microseconds].
+   *
+   * \return bool indicating if the round-trip time indicates overload.
+   */
+  bool isLatencyOverloaded(const std::string& endpoint_class, const Poco::Int64 latency);
+
+  /**
+   * \brief Static constant for the weight of a new round-trip time in the smoothed round-trip time.
+   */
+  static const double SMOOTHING_FACTOR;
+
+  /**
+   * \brief Static constant for the weight of a new (higher) round-trip time in the baseline round-trip time.
+   */
+  static const double BASELINE_DRIFT_FACTOR;
+
+  /**
+   * \brief The limiter's configuration.
+   */
+  const Configuration configuration_;
+
+  /**
+   * \brief Mutex for protecting the limiter.
+   */
+  Poco::Mutex mutex_;
+
+  /**
+   * \brief A condition for signaling that a permit has been released (or that the limit has grown).
+   */
+  Poco::Condition condition_;
+
+  /**
+   * \brief The current limit [requests].
+   */
+  double limit_;
+
+  /**
+   * \brief The number of active requests.
+   */
+  size_t active_requests_;
+
+  /**
+   * \brief The point in time of the last cut of the limit.
+   */
+  Poco::Timestamp last_decrease_;
+
+  /**
+   * \brief The number of times the limit has been cut.
+   */
+  Poco::UInt64 decreases_;
+
+  /**
+   * \brief The round-trip time statistics (mapped by endpoint class).
+   */
+  std::map<std::string, LatencyStatistics> latencies_;
+};
+
+} // end namespace rws
+} // end namespace abb
+
+#endif
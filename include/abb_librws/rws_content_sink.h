@@ -0,0 +1,220 @@
+/***********************************************************************************************************************
+ *
+ * Copyright (c) 2026, ABB Schweiz AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with
+ * or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer in the documentation
+ *      and/or other materials provided with the
+ *      distribution.
+ *    * Neither the name of ABB nor the names of its
+ *      contributors may be used to endorse or promote
+ *      products derived from this software without
+ *      specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ***********************************************************************************************************************
+ */
+
+#ifndef RWS_CONTENT_SINK_H
+#define RWS_CONTENT_SINK_H
+
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+
+#include "Poco/Foundation.h"
+
+namespace abb
+{
+namespace rws
+{
+/**
+ * \brief An abstract class for receiving a HTTP response's content in chunks, instead of buffering all of it.
+ *
+ * This keeps the memory usage bounded (by the chunk size), regardless of the content's size.
+ */
+class ContentSink
+{
+public:
+  /**
+   * \brief A destructor.
+   */
+  virtual ~ContentSink() {}
+
+  /**
+   * \brief A method called before the first chunk is written.
+   *
+   * Note: If a request is resent (e.g. after an authentication challenge), then this is only called for the response
+   *       whose content is actually written.
+   *
+   * \param content_length for the content's length [bytes] (negative if unknown).
+   */
+  virtual void begin(const Poco::Int64 content_length) { (void) content_length; }
+
+  /**
+   * \brief A method for writing a chunk of the content.
+   *
+   * \param data for the chunk's data.
+   * \param size for the chunk's size [bytes].
+   *
+   * \return bool indicating if the transfer should continue. If false, then the transfer is aborted.
+   */
+  virtual bool write(const char* data, const size_t size) = 0;
+};
+
+/**
+ * \brief A class for writing content to a standard output stream (e.g. a std::ofstream).
+ */
+class StreamContentSink : public ContentSink
+{
+public:
+  /**
+   * \brief A constructor.
+   *
+   * \param stream for the stream to write to (it must outlive the sink).
+   */
+  explicit StreamContentSink(std::ostream& stream) : stream_(stream) {}
+
+  /**
+   * \brief A method for writing a chunk of the content (see ContentSink::write(...)).
+   *
+   * \param data for the chunk's data.
+   * \param size for the chunk's size [bytes].
+   *
+   * \return bool indicating if the chunk was written (i.e. false if the stream has failed).
+   */
+  bool write(const char* data, const size_t size);
+
+private:
+  /**
+   * \brief The stream to write to.
+   */
+  std::ostream& stream_;
+};
+
+/**
+ * \brief A class for collecting content in a string (sized up front, if the content's length is known).
+ */
+class StringContentSink : public ContentSink
+{
+public:
+  /**
+   * \brief A constructor.
+   *
+   * \param content for the string to append the content to (it must outlive the sink).
+   */
+  explicit StringContentSink(std::string& content) : content_(content) {}
+
+  /**
+   * \brief A method called before the first chunk is written (see ContentSink::begin(...)).
+   *
+   * \param content_length for the content's length [bytes] (negative if unknown).
+   */
+  void begin(const Poco::Int64 content_length);
+
+  /**
+   * \brief A method for writing a chunk of the content (see ContentSink::write(...)).
+   *
+   * \param data for the chunk's data.
+   * \param size for the chunk's size [bytes].
+   *
+   * \return bool indicating if the transfer should continue (always true).
+   */
+  bool write(const char* data, const size_t size);
+
+private:
+  /**
+   * \brief The string to append the content to.
+   */
+  std::string& content_;
+};
+
+/**
+ * \brief A class for writing content to a file descriptor (e.g. an open file, or a pipe).
+ */
+class FileDescriptorContentSink : public ContentSink
+{
+public:
+  /**
+   * \brief A constructor.
+   *
+   * \param file_descriptor for the file descriptor to write to (it is not closed by the sink).
+   */
+  explicit FileDescriptorContentSink(const int file_descriptor) : file_descriptor_(file_descriptor) {}
+
+  /**
+   * \brief A method for writing a chunk of the content (see ContentSink::write(...)).
+   *
+   * \param data for the chunk's data.
+   * \param size for the chunk's size [bytes].
+   *
+   * \return bool indicating if the chunk was written (i.e. false if writing failed).
+   */
+  bool write(const char* data, const size_t size);
+
+private:
+  /**
+   * \brief The file descriptor to write to.
+   */
+  const int file_descriptor_;
+};
+
+/**
+ * \brief A class for handing content over to a callback, chunk by chunk.
+ */
+class CallbackContentSink : public ContentSink
+{
+public:
+  /**
+   * \brief A callback for receiving a chunk. It returns false to abort the transfer.
+   */
+  typedef std::function<bool(const char* data, const size_t size)> Callback;
+
+  /**
+   * \brief A constructor.
+   *
+   * \param callback for the callback to hand the chunks over to.
+   */
+  explicit CallbackContentSink(const Callback& callback) : callback_(callback) {}
+
+  /**
+   * \brief A method for writing a chunk of the content (see ContentSink::write(...)).
+   *
+   * \param data for the chunk's data.
+   * \param size for the chunk's size [bytes].
+   *
+   * \return bool indicating if the transfer should continue.
+   */
+  bool write(const char* data, const size_t size) { return callback_(data, size); }
+
+private:
+  /**
+   * \brief The callback to hand the chunks over to.
+   */
+  Callback callback_;
+};
+
+} // end namespace rws
+} // end namespace abb
+
+#endif
@@ -0,0 +1,347 @@
+/***********************************************************************************************************************
+ *
+ * Copyright (c) 2026, ABB Schweiz AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with
+ * or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer in the documentation
+ *      and/or other materials provided with the
+ *      distribution.
+ *    * Neither the name of ABB nor the names of its
+ *      contributors may be used to endorse or promote
+ *      products derived from this software without
+ *      specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ***********************************************************************************************************************
+ */
+
+#ifndef RWS_CONTENT_SOURCE_H
+#define RWS_CONTENT_SOURCE_H
+
+#include <cstddef>
+#include <functional>
+#include <istream>
+#include <string>
+
+#include "Poco/Buffer.h"
+#include "Poco/SharedMemory.h"
+
+namespace abb
+{
+namespace rws
+{
+/**
+ * \brief An abstract class for providing a HTTP request's content in chunks, instead of as one (copied) string.
+ *
+ * This keeps the memory usage bounded (by the chunk size), regardless of the content's size.
+ */
+class ContentSource
+{
+public:
+  /**
+   * \brief A destructor.
+   */
+  virtual ~ContentSource() {}
+
+  /**
+   * \brief A method for retrieving the content's length.
+   *
+   * Note: If the length is unknown, then the content is sent with chunked transfer encoding.
+   *
+   * \return Poco::Int64 containing the content's length [bytes] (negative if unknown).
+   */
+  virtual Poco::Int64 getLength() const = 0;
+
+  /**
+   * \brief A method for retrieving the next chunk of the content.
+   *
+   * \param data for pointing to the chunk's data (owned by the source, and valid until the next call).
+   * \param size for the chunk's size [bytes].
+   *
+   * \return bool indicating if a chunk was retrieved (false at the end of the content).
+   *
+   * \throw Poco::IOException if the content could not be read.
+   */
+  virtual bool next(const char*& data, size_t& size) = 0;
+
+  /**
+   * \brief A method for restarting the content from the beginning (e.g. for resending a request).
+   *
+   * \return bool indicating if the content was restarted (false if the source cannot be rewound).
+   */
+  virtual bool rewind() = 0;
+
+protected:
+  /**
+   * \brief Static constant for the size of the chunks that content is provided in [bytes].
+   */
+  static const size_t CHUNK_SIZE = 64 * 1024;
+};
+
+/**
+ * \brief A class for providing content from memory owned by the caller (without copying it).
+ */
+class MemoryContentSource : public ContentSource
+{
+public:
+  /**
+   * \brief A constructor.
+   *
+   * \param data for the content's data (it must outlive the source).
+   * \param size for the content's size [bytes].
+   */
+  MemoryContentSource(const char* data, const size_t size) : data_(data), size_(size), position_(0) {}
+
+  /**
+   * \brief A constructor.
+   *
+   * \param content for the content (it must outlive the source).
+   */
+  explicit MemoryContentSource(const std::string& content)
+  :
+  data_(content.data()),
+  size_(content.size()),
+  position_(0)
+  {}
+
+  /**
+   * \brief A method for retrieving the content's length (see ContentSource::getLength()).
+   *
+   * \return Poco::Int64 containing the content's length [bytes].
+   */
+  Poco::Int64 getLength() const { return static_cast<Poco::Int64>(size_); }
+
+  /**
+   * \brief A method for retrieving the next chunk of the content (see ContentSource::next(...)).
+   *
+   * \param data for pointing to the chunk's data.
+   * \param size for the chunk's size [bytes].
+   *
+   * \return bool indicating if a chunk was retrieved.
+   */
+  bool next(const char*& data, size_t& size);
+
+  /**
+   * \brief A method for restarting the content from the beginning (see ContentSource::rewind()).
+   *
+   * \return bool indicating if the content was restarted (always true).
+   */
+  bool rewind() { position_ = 0; return true; }
+
+protected:
+  /**
+   * \brief A default constructor, for subclasses that set the data later (see setData(...)).
+   */
+  MemoryContentSource() : data_(0), size_(0), position_(0) {}
+
+  /**
+   * \brief A method for setting the content's data.
+   *
+   * \param data for the content's data.
+   * \param size for the content's size [bytes].
+   */
+  void setData(const char* data, const size_t size) { data_ = data; size_ = size; position_ = 0; }
+
+private:
+  /**
+   * \brief The content's data.
+   */
+  const char* data_;
+
+  /**
+   * \brief The content's size [bytes].
+   */
+  size_t size_;
+
+  /**
+   * \brief Position of the next chunk.
+   */
+  size_t position_;
+};
+
+/**
+ * \brief A class for providing the content of a file, which is memory-mapped (i.e. it is not read into buffers).
+ */
+class MappedFileContentSource : public MemoryContentSource
+{
+public:
+  /**
+   * \brief A constructor.
+   *
+   * \param path for the file's path.
+   *
+   * \throw Poco::FileException (or a subclass) if the file could not be opened or mapped.
+   */
+  explicit MappedFileContentSource(const std::string& path);
+
+private:
+  /**
+   * \brief The file's memory mapping (unused for empty files, which cannot be mapped).
+   */
+  Poco::SharedMemory mapping_;
+};
+
+/**
+ * \brief A class for providing content from a standard input stream (e.g. a std::ifstream).
+ */
+class StreamContentSource : public ContentSource
+{
+public:
+  /**
+   * \brief A constructor.
+   *
+   * Note: If the length is not specified, then it is determined by seeking (if the stream supports it).
+   *
+   * \param stream for the stream to read from (it must outlive the source).
+   * \param length for the content's length [bytes] (negative if unknown).
+   */
+  explicit StreamContentSource(std::istream& stream, const Poco::Int64 length = -1);
+
+  /**
+   * \brief A method for retrieving the content's length (see ContentSource::getLength()).
+   *
+   * \return Poco::Int64 containing the content's length [bytes] (negative if unknown).
+   */
+  Poco::Int64 getLength() const { return length_; }
+
+  /**
+   * \brief A method for retrieving the next chunk of the content (see ContentSource::next(...)).
+   *
+   * \param data for pointing to the chunk's data.
+   * \param size for the chunk's size [bytes].
+   *
+   * \return bool indicating if a chunk was retrieved.
+   *
+   * \throw Poco::IOException if the stream failed.
+   */
+  bool next(const char*& data, size_t& size);
+
+  /**
+   * \brief A method for restarting the content from the beginning (see ContentSource::rewind()).
+   *
+   * \return bool indicating if the content was restarted (false if the stream is not seekable).
+   */
+  bool rewind();
+
+private:
+  /**
+   * \brief The stream to read from.
+   */
+  std::istream& stream_;
+
+  /**
+   * \brief The content's length [bytes] (negative if unknown).
+   */
+  Poco::Int64 length_;
+
+  /**
+   * \brief The stream's initial position (negative if the stream is not seekable).
+   */
+  std::streamoff start_;
+
+  /**
+   * \brief Buffer for the current chunk.
+   */
+  Poco::Buffer<char> buffer_;
+};
+
+/**
+ * \brief A class for providing content produced by a callback, chunk by chunk.
+ */
+class CallbackContentSource : public ContentSource
+{
+public:
+  /**
+   * \brief A callback for producing a chunk. It fills the buffer, and returns the number of bytes (0 at the end).
+   */
+  typedef std::function<size_t(char* buffer, const size_t capacity)> Producer;
+
+  /**
+   * \brief A callback for restarting the production from the beginning. It returns false if that is not possible.
+   */
+  typedef std::function<bool()> Rewinder;
+
+  /**
+   * \brief A constructor.
+   *
+   * \param producer for the callback producing the chunks.
+   * \param length for the content's length [bytes] (negative if unknown).
+   * \param rewinder for an optional callback for restarting the production (without it, resending is impossible).
+   */
+  CallbackContentSource(const Producer& producer, const Poco::Int64 length = -1, const Rewinder& rewinder = Rewinder())
+  :
+  producer_(producer),
+  rewinder_(rewinder),
+  length_(length),
+  buffer_(CHUNK_SIZE)
+  {}
+
+  /**
+   * \brief A method for retrieving the content's length (see ContentSource::getLength()).
+   *
+   * \return Poco::Int64 containing the content's length [bytes] (negative if unknown).
+   */
+  Poco::Int64 getLength() const { return length_; }
+
+  /**
+   * \brief A method for retrieving the next chunk of the content (see ContentSource::next(...)).
+   *
+   * \param data for pointing to the chunk's data.
+   * \param size for the chunk's size [bytes].
+   *
+   * \return bool indicating if a chunk was retrieved.
+   */
+  bool next(const char*& data, size_t& size);
+
+  /**
+   * \brief A method for restarting the content from the beginning (see ContentSource::rewind()).
+   *
+   * \return bool indicating if the content was restarted.
+   */
+  bool rewind() { return rewinder_ && rewinder_(); }
+
+private:
+  /**
+   * \brief The callback producing the chunks.
+   */
+  Producer producer_;
+
+  /**
+   * \brief The callback restarting the production.
+   */
+  Rewinder rewinder_;
+
+  /**
+   * \brief The content's length [bytes] (negative if unknown).
+   */
+  Poco::Int64 length_;
+
+  /**
+   * \brief Buffer for the current chunk.
+   */
+  Poco::Buffer<char> buffer_;
+};
+
+} // end namespace rws
+} // end namespace abb
+
+#endif
@@ -0,0 +1,149 @@
+/***********************************************************************************************************************
+ *
+ * Copyright (c) 2026, ABB Schweiz AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with
+ * or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer in the documentation
+ *      and/or other materials provided with the
+ *      distribution.
+ *    * Neither the name of ABB nor the names of its
+ *      contributors may be used to endorse or promote
+ *      products derived from this software without
+ *      specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ***********************************************************************************************************************
+ */
+
+#ifndef RWS_EXECUTOR_H
+#define RWS_EXECUTOR_H
+
+#include <deque>
+#include <functional>
+#include <vector>
+
+#include "Poco/Condition.h"
+#include "Poco/Mutex.h"
+#include "Poco/RunnableAdapter.h"
+#include "Poco/SharedPtr.h"
+#include "Poco/Thread.h"
+
+namespace abb
+{
+namespace rws
+{
+/**
+ * \brief A class for a simple executor, which runs queued tasks on a fixed number of worker threads.
+ *
+ * Tasks are queued without limit, i.e. any number of tasks can be outstanding without requiring one thread per task.
+ */
+class Executor
+{
+public:
+  /**
+   * \brief A type for representing a task.
+   */
+  typedef std::function<void()> Task;
+
+  /**
+   * \brief A constructor.
+   *
+   * \param number_of_threads for the number of worker threads (at least one thread is always started).
+   */
+  explicit Executor(const size_t number_of_threads = DEFAULT_NUMBER_OF_THREADS);
+
+  /**
+   * \brief A destructor.
+   *
+   * Already queued tasks are completed before the worker threads are joined.
+   *
+   * Note: Must not be called from one of the executor's own tasks.
+   */
+  ~Executor();
+
+  /**
+   * \brief A method for queueing a task for execution.
+   *
+   * \param task for the task to execute. Any exception thrown by the task is swallowed.
+   */
+  void submit(const Task& task);
+
+  /**
+   * \brief A method for retrieving the number of worker threads.
+   *
+   * \return size_t containing the number of worker threads.
+   */
+  size_t getNumberOfThreads() const { return threads_.size(); }
+
+  /**
+   * \brief A method for retrieving the number of tasks that are waiting to be executed.
+   *
+   * \return size_t containing the number of queued tasks.
+   */
+  size_t getNumberOfQueuedTasks();
+
+  /**
+   * \brief Static constant for the default number of worker threads.
+   */
+  static const size_t DEFAULT_NUMBER_OF_THREADS = 4;
+
+private:
+  /**
+   * \brief The worker threads' main loop.
+   */
+  void work();
+
+  /**
+   * \brief A mutex for protecting the task queue.
+   */
+  Poco::Mutex mutex_;
+
+  /**
+   * \brief A condition for signaling that a task has been queued (or that the executor is stopping).
+   */
+  Poco::Condition condition_;
+
+  /**
+   * \brief The queued tasks.
+   */
+  std::deque<Task> tasks_;
+
+  /**
+   * \brief Flag indicating if the executor is stopping.
+   */
+  bool stopping_;
+
+  /**
+   * \brief Adapter for running the work loop in the worker threads.
+   */
+  Poco::RunnableAdapter<Executor> runnable_;
+
+  /**
+   * \brief The worker threads.
+   */
+  std::vector<Poco::SharedPtr<Poco::Thread> > threads_;
+};
+
+} // end namespace rws
+} // end namespace abb
+
+#endif
@@ -0,0 +1,252 @@
+/***********************************************************************************************************************
+ *
+ * Copyright (c) 2026, ABB Schweiz AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with
+ * or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer in the documentation
+ *      and/or other materials provided with the
+ *      distribution.
+ *    * Neither the name of ABB nor the names of its
+ *      contributors may be used to endorse or promote
+ *      products derived from this software without
+ *      specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ***********************************************************************************************************************
+ */
+
+#ifndef RWS_FILE_MIRROR_H
+#define RWS_FILE_MIRROR_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Poco/Foundation.h"
+#include "Poco/Mutex.h"
+
+#include "rws_client.h"
+
+namespace abb
+{
+namespace rws
+{
+/**
+ * \brief A class for mirroring a directory tree from the robot controller's file service to a local directory.
+ *
+ * The remote tree is listed recursively (one request per directory), and each file's size and modification date are
+ * compared against a local manifest, which records the state of the files that were downloaded by earlier
+ * synchronizations. Only new and changed files are downloaded, in parallel and with a cap on the number of concurrent
+ * downloads. I.e. synchronizing an unchanged tree costs about one listing round trip per directory.
+ *
+ * Note: The downloads share the client's connection pool, so set its size (see POCOClient::setConnectionPoolSize(...))
+ *       to at least the number of concurrent downloads (plus one for the listings) to avoid waiting for connections.
+ */
+class FileMirror
+{
+public:
+  /**
+   * \brief A struct for containing the mirror's configuration.
+   */
+  struct Configuration
+  {
+    /**
+     * \brief The maximum number of files that are downloaded concurrently.
+     */
+    size_t max_concurrent_downloads;
+
+    /**
+     * \brief The name of the manifest file (stored in the local directory's root).
+     */
+    std::string manifest_filename;
+
+    /**
+     * \brief A default constructor.
+     */
+    Configuration()
+    :
+    max_concurrent_downloads(3),
+    manifest_filename(".rws_manifest")
+    {}
+  };
+
+  /**
+   * \brief A struct for containing the result of a synchronization.
+   */
+  struct Result
+  {
+    /**
+     * \brief Flag indicating if the synchronization was successful (i.e. all directories and files were mirrored).
+     */
+    bool success;
+
+    /**
+     * \brief Number of directories that were listed.
+     */
+    size_t listed_directories;
+
+    /**
+     * \brief Number of files that were downloaded.
+     */
+    size_t downloaded_files;
+
+    /**
+     * \brief Number of files that were unchanged (i.e. not downloaded).
+     */
+    size_t unchanged_files;
+
+    /**
+     * \brief Number of bytes that were downloaded.
+     */
+    Poco::UInt64 downloaded_bytes;
+
+    /**
+     * \brief The paths (relative to the mirrored directory) of the directories and files that could not be mirrored.
+     */
+    std::vector<std::string> failed_paths;
+
+    /**
+     * \brief A default constructor.
+     */
+    Result() : success(false), listed_directories(0), downloaded_files(0), unchanged_files(0), downloaded_bytes(0) {}
+  };
+
+  /**
+   * \brief A constructor.
+   *
+   * \param client for the client to communicate with the robot controller (it must outlive the mirror).
+   * \param configuration for the mirror's configuration.
+   */
+  FileMirror(RWSClient& client, const Configuration& configuration = Configuration());
+
+  /**
+   * \brief A method for synchronizing a local directory with a directory tree on the robot controller.
+   *
+   * Local files are replaced atomically (i.e. via temporary files), and files that have been removed from the
+   * robot controller are kept locally. Files that could not be downloaded are retried at the next synchronization.
+   *
+   * \param remote_directory for the directory on the robot controller (e.g. "$home").
+   * \param local_directory for the local directory (created if needed).
+   * \param options for the requests' options (e.g. a deadline for the complete synchronization).
+   *
+   * \return Result containing the result.
+   */
+  Result synchronize(const std::string& remote_directory,
+                     const std::string& local_directory,
+                     const RWSClient::RequestOptions& options = RWSClient::RequestOptions());
+
+private:
+  /**
+   * \brief A struct for the state of a mirrored file, as it was listed by the robot controller.
+   */
+  struct FileState
+  {
+    /**
+     * \brief A default constructor.
+     */
+    FileState() : size(0) {}
+
+    /**
+     * \brief A method for comparing two file states.
+     *
+     * \param other for the other file state.
+     *
+     * \return bool indicating if the file states are equal.
+     */
+    bool operator==(const FileState& other) const { return size == other.size && modified == other.modified; }
+
+    /**
+     * \brief The file's size [bytes].
+     */
+    Poco::UInt64 size;
+
+    /**
+     * \brief The file's modification date (as listed).
+     */
+    std::string modified;
+  };
+
+  /**
+   * \brief A type for a manifest, which maps paths (relative to the mirrored directory) to file states.
+   */
+  typedef std::map<std::string, FileState> Manifest;
+
+  /**
+   * \brief A method for downloading one file (called by the worker threads).
+   *
+   * \param remote_directory for the file's directory on the robot controller.
+   * \param filename for the file's name.
+   * \param local_path for the file's local path.
+   * \param relative_path for the file's path relative to the mirrored directory.
+   * \param state for the file's listed state.
+   * \param options for the request's options.
+   * \param manifest for the manifest to record the downloaded file in.
+   * \param result for the result to update.
+   */
+  void download(const std::string& remote_directory,
+                const std::string& filename,
+                const std::string& local_path,
+                const std::string& relative_path,
+                const FileState& state,
+                const RWSClient::RequestOptions& options,
+                Manifest& manifest,
+                Result& result);
+
+  /**
+   * \brief A method for loading a manifest from a file.
+   *
+   * \param path for the manifest file's path.
+   *
+   * \return Manifest containing the loaded manifest (empty if the file is missing or cannot be read).
+   */
+  static Manifest loadManifest(const std::string& path);
+
+  /**
+   * \brief A method for saving a manifest to a file (atomically, via a temporary file).
+   *
+   * \param path for the manifest file's path.
+   * \param manifest for the manifest to save.
+   *
+   * \return bool indicating if the manifest was saved.
+   */
+  static bool saveManifest(const std::string& path, const Manifest& manifest);
+
+  /**
+   * \brief The client to communicate with the robot controller.
+   */
+  RWSClient& client_;
+
+  /**
+   * \brief The mirror's configuration.
+   */
+  const Configuration configuration_;
+
+  /**
+   * \brief Mutex for protecting the manifest and the result, while files are being downloaded.
+   */
+  Poco::Mutex mutex_;
+};
+
+} // end namespace rws
+} // end namespace abb
+
+#endif
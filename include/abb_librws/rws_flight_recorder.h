@@ -0,0 +1,288 @@
+/***********************************************************************************************************************
+ *
+ * Copyright (c) 2026, ABB Schweiz AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with
+ * or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer in the documentation
+ *      and/or other materials provided with the
+ *      distribution.
+ *    * Neither the name of ABB nor the names of its
+ *      contributors may be used to endorse or promote
+ *      products derived from this software without
+ *      specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ***********************************************************************************************************************
+ */
+
+#ifndef RWS_FLIGHT_RECORDER_H
+#define RWS_FLIGHT_RECORDER_H
+
+#include <atomic>
+#include <vector>
+
+#include "rws_poco_client.h"
+
+namespace abb
+{
+namespace rws
+{
+/**
+ * \brief A class for a fixed-capacity flight recorder, which keeps compact records of the latest communications.
+ *
+ * The records are kept in a preallocated ring buffer. Any number of threads can add records concurrently without
+ * locking, and readers never block writers. Each record only keeps a summary of a communication (i.e. method, URI,
+ * status, timing and byte counts), and, depending on the verbosity, a truncated copy of the received content.
+ */
+class FlightRecorder
+{
+public:
+  /**
+   * \brief An enum for specifying how much is captured for each communication.
+   */
+  enum Verbosity
+  {
+    SUMMARY, ///< Only the summary is captured.
+    CONTENT  ///< The summary, and a truncated copy of the received content, is captured.
+  };
+
+  /**
+   * \brief A struct for containing a compact record of a communication.
+   *
+   * Note: The record only uses fixed-size members, so that it can be copied into (and out of) the ring buffer as is.
+   */
+  struct Record
+  {
+    /**
+     * \brief Static constant for the maximum length of a recorded method.
+     */
+    static const size_t MAX_METHOD_LENGTH = 8;
+
+    /**
+     * \brief Static constant for the maximum length of a recorded URI (longer URIs are truncated).
+     */
+    static const size_t MAX_URI_LENGTH = 128;
+
+    /**
+     * \brief Static constant for the maximum length of a recorded exception message (longer messages are truncated).
+     */
+    static const size_t MAX_EXCEPTION_LENGTH = 128;
+
+    /**
+     * \brief Static constant for the maximum length of a recorded content (longer contents are truncated).
+     */
+    static const size_t MAX_CONTENT_LENGTH = 512;
+
+    /**
+     * \brief Time when the record was added [microseconds since the Unix epoch].
+     */
+    Poco::Int64 timestamp;
+
+    /**
+     * \brief Duration of the communication [microseconds].
+     */
+    Poco::Int64 duration;
+
+    /**
+     * \brief The communication's general status.
+     */
+    POCOClient::POCOResult::GeneralStatus status;
+
+    /**
+     * \brief The HTTP response status.
+     */
+    Poco::Net::HTTPResponse::HTTPStatus http_status;
+
+    /**
+     * \brief Flags from a received WebSocket frame.
+     */
+    int websocket_flags;
+
+    /**
+     * \brief Number of bytes sent as request content.
+     */
+    Poco::UInt64 request_bytes;
+
+    /**
+     * \brief Number of bytes received as response (or WebSocket frame) content.
+     */
+    Poco::UInt64 response_bytes;
+
+    /**
+     * \brief The HTTP request method (empty for WebSocket frames).
+     */
+    char method[MAX_METHOD_LENGTH];
+
+    /**
+     * \brief The HTTP request URI.
+     */
+    char uri[MAX_URI_LENGTH];
+
+    /**
+     * \brief An exception message (if one occurred).
+     */
+    char exception_message[MAX_EXCEPTION_LENGTH];
+
+    /**
+     * \brief The received content (only captured at the CONTENT verbosity).
+     */
+    char content[MAX_CONTENT_LENGTH];
+
+    /**
+     * \brief Number of characters in the recorded content.
+     */
+    size_t content_length;
+
+    /**
+     * \brief A method for converting the record into a POCO result, e.g. for rendering it into text.
+     *
+     * \return POCOClient::POCOResult containing the recorded info.
+     */
+    POCOClient::POCOResult toPOCOResult() const;
+
+    /**
+     * \brief A method for constructing a text representation of the record.
+     *
+     * \param verbose indicating if the text should be verbose or not.
+     * \param indent for indentation.
+     *
+     * \return std::string containing the text representation.
+     */
+    std::string toString(const bool verbose, const size_t indent) const;
+  };
+
+  /**
+   * \brief A constructor.
+   *
+   * \param capacity for the number of records that are kept (at least one record is always kept).
+   */
+  explicit FlightRecorder(const size_t capacity = DEFAULT_CAPACITY);
+
+  /**
+   * \brief A method for adding a record of a communication.
+   *
+   * Note: Safe to call from any number of threads concurrently. In the (rare) event that a writer is lapped by other
+   *       writers, i.e. the whole ring buffer is written over while the writer is busy, the record is dropped.
+   *
+   * \param poco_result for the communication's result.
+   */
+  void record(const POCOClient::POCOResult& poco_result);
+
+  /**
+   * \brief A method for retrieving the latest records.
+   *
+   * \param max_records for the maximum number of records to retrieve.
+   *
+   * \return std::vector<Record> containing the records, ordered from the latest to the oldest.
+   */
+  std::vector<Record> getRecords(const size_t max_records = DEFAULT_CAPACITY) const;
+
+  /**
+   * \brief A method for setting the verbosity (i.e. how much is captured for each communication).
+   *
+   * \param verbosity for the verbosity.
+   */
+  void setVerbosity(const Verbosity verbosity) { verbosity_ = verbosity; }
+
+  /**
+   * \brief A method for retrieving the verbosity.
+   *
+   * \return Verbosity containing the verbosity.
+   */
+  Verbosity getVerbosity() const { return verbosity_; }
+
+  /**
+   * \brief A method for retrieving the capacity (i.e. the maximum number of kept records).
+   *
+   * \return size_t containing the capacity.
+   */
+  size_t getCapacity() const { return slots_.size(); }
+
+  /**
+   * \brief A method for retrieving the total number of added records (including overwritten and dropped records).
+   *
+   * \return Poco::UInt64 containing the number of records.
+   */
+  Poco::UInt64 getNumberOfRecords() const { return next_ticket_; }
+
+  /**
+   * \brief A method for retrieving the number of dropped records.
+   *
+   * \return Poco::UInt64 containing the number of dropped records.
+   */
+  Poco::UInt64 getNumberOfDroppedRecords() const { return dropped_records_; }
+
+  /**
+   * \brief Static constant for the default number of kept records.
+   */
+  static const size_t DEFAULT_CAPACITY = 64;
+
+private:
+  /**
+   * \brief A struct for a slot in the ring buffer.
+   *
+   * The slot's sequence number works as a seqlock: it is odd while the record is written, and 2 * (ticket + 1) once
+   * the record for a ticket has been completely written. Zero means that the slot has never been written.
+   */
+  struct Slot
+  {
+    /**
+     * \brief The slot's sequence number.
+     */
+    std::atomic<Poco::UInt64> sequence;
+
+    /**
+     * \brief The slot's record.
+     */
+    Record record;
+
+    /**
+     * \brief A default constructor.
+     */
+    Slot() : sequence(0) {}
+  };
+
+  /**
+   * \brief The ring buffer.
+   */
+  std::vector<Slot> slots_;
+
+  /**
+   * \brief The next ticket to hand out to a writer (i.e. the total number of added records).
+   */
+  std::atomic<Poco::UInt64> next_ticket_;
+
+  /**
+   * \brief The number of dropped records.
+   */
+  std::atomic<Poco::UInt64> dropped_records_;
+
+  /**
+   * \brief The verbosity.
+   */
+  std::atomic<Verbosity> verbosity_;
+};
+
+} // end namespace rws
+} // end namespace abb
+
+#endif
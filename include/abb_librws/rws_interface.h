@@ -504,10 +504,12 @@ public:
    * \brief A method for retrieving the value if an IO signal.
    *
    * \param iosignal for the name of the IO signal.
+   * \param options for the request's options (e.g. a deadline).
    *
    * \return std::string containing the IO signal's value (empty if not found).
    */
-  std::string getIOSignal(const std::string& iosignal);
+  std::string getIOSignal(const std::string& iosignal,
+                          const RWSClient::RequestOptions& options = RWSClient::RequestOptions());
 
   /**
    * \brief A method for retrieving static information about a mechanical unit.
@@ -630,33 +632,42 @@ public:
   /**
    * \brief A method for checking if the robot controller mode is in auto mode.
    *
+   * \param options for the request's options (e.g. a deadline).
+   *
    * \return TriBool indicating if the mode is auto or not or unknown.
    */
-  TriBool isAutoMode();
+  TriBool isAutoMode(const RWSClient::RequestOptions& options = RWSClient::RequestOptions());
 
   /**
    * \brief A method for checking if the motors are on.
    *
+   * \param options for the request's options (e.g. a deadline).
+   *
    * \return TriBool indicating if the motors are on or not or unknown.
    */
-  TriBool isMotorsOn();
+  TriBool isMotorsOn(const RWSClient::RequestOptions& options = RWSClient::RequestOptions());
 
   /**
    * \brief A method for checking if RAPID is running.
    *
+   * \param options for the request's options (e.g. a deadline).
+   *
    * \return TriBool indicating if RAPID is running or not or unknown.
    */
-  TriBool isRAPIDRunning();
+  TriBool isRAPIDRunning(const RWSClient::RequestOptions& options = RWSClient::RequestOptions());
 
   /**
    * \brief A method for setting the value of an IO signal.
    *
    * \param iosignal for the name of the IO signal.
    * \param value for the IO signal's new value.
+   * \param options for the request's options (e.g. a deadline).
    *
    * \return bool indicating if the communication was successful or not.
    */
-  bool setIOSignal(const std::string& iosignal, const std::string& value);
+  bool setIOSignal(const std::string& iosignal,
+                   const std::string& value,
+                   const RWSClient::RequestOptions& options = RWSClient::RequestOptions());
 
   /**
    * \brief A method for setting the data of a RAPID symbol via raw text format.
@@ -774,6 +785,16 @@ public:
    */
   bool getFile(const RWSClient::FileResource& resource, std::string* p_file_content);
 
+  /**
+   * \brief A method for retrieving a file from the robot controller, and for streaming it into a sink.
+   *
+   * \param resource specifying the file's directory and name.
+   * \param sink for the sink to write the file's content to (see RWSClient::getFile(...)).
+   *
+   * \return bool indicating if the communication was successful or not.
+   */
+  bool getFile(const RWSClient::FileResource& resource, ContentSink& sink);
+
   /**
    * \brief A method for uploading a file to the robot controller.
    *
@@ -784,6 +805,16 @@ public:
    */
   bool uploadFile(const RWSClient::FileResource& resource, const std::string& file_content);
 
+  /**
+   * \brief A method for uploading a file to the robot controller, with its content streamed from a source.
+   *
+   * \param resource specifying the file's directory and name.
+   * \param source for the source to read the file's content from (see RWSClient::uploadFile(...)).
+   *
+   * \return bool indicating if the communication was successful or not.
+   */
+  bool uploadFile(const RWSClient::FileResource& resource, ContentSource& source);
+
   /**
    * \brief A method for deleting a file from the robot controller.
    *
@@ -893,6 +924,131 @@ public:
     rws_client_.setHTTPTimeout(timeout);
   }
 
+  /**
+   * \brief A method for setting the maximum number of HTTP connections that can be used concurrently.
+   *
+   * \param size for the maximum number of concurrent HTTP connections.
+   */
+  void setConnectionPoolSize(const size_t size)
+  {
+    rws_client_.setConnectionPoolSize(size);
+  }
+
+  /**
+   * \brief A method for enabling/disabling HTTP/1.1 pipelining of GET request bursts.
+   *
+   * \param enabled for indicating if pipelining should be used or not.
+   */
+  void setPipeliningEnabled(const bool enabled)
+  {
+    rws_client_.setPipeliningEnabled(enabled);
+  }
+
+  /**
+   * \brief A method for enabling/disabling the coalescing of identical concurrent HTTP GET requests (disabled by
+   * default).
+   *
+   * \param enabled for indicating if identical concurrent HTTP GET requests should be coalesced or not.
+   */
+  void setRequestCoalescingEnabled(const bool enabled)
+  {
+    rws_client_.setRequestCoalescingEnabled(enabled);
+  }
+
+  /**
+   * \brief A method for enabling/disabling the reserved connection for control commands (enabled by default).
+   *
+   * \param enabled for indicating if a connection should be reserved for control commands or not.
+   */
+  void setControlLaneEnabled(const bool enabled)
+  {
+    rws_client_.setControlLaneEnabled(enabled);
+  }
+
+  /**
+   * \brief A method for retrieving the client's bandwidth limiter for file transfers (unlimited by default).
+   *
+   * \return Poco::SharedPtr<BandwidthLimiter> for the limiter (null if disabled).
+   */
+  Poco::SharedPtr<BandwidthLimiter> getBandwidthLimiter()
+  {
+    return rws_client_.getBandwidthLimiter();
+  }
+
+  /**
+   * \brief A method for retrieving the controller's bandwidth limiter for file transfers (unlimited by default).
+   *
+   * The limiter is shared by all clients to the same controller in the process.
+   *
+   * \return Poco::SharedPtr<BandwidthLimiter> for the limiter (null if disabled).
+   */
+  Poco::SharedPtr<BandwidthLimiter> getControllerBandwidthLimiter()
+  {
+    return rws_client_.getControllerBandwidthLimiter();
+  }
+
+  /**
+   * \brief A method for setting an adaptive concurrency limiter (disabled by default).
+   *
+   * Use ConcurrencyLimiter::getInstance(...) to share the limit with all clients to the same controller.
+   *
+   * \param p_concurrency_limiter for the limiter (a null pointer disables the limiting).
+   */
+  void setConcurrencyLimiter(const Poco::SharedPtr<ConcurrencyLimiter>& p_concurrency_limiter)
+  {
+    rws_client_.setConcurrencyLimiter(p_concurrency_limiter);
+  }
+
+  /**
+   * \brief A method for retrieving the adaptive concurrency limiter (e.g. for inspecting the current limit).
+   *
+   * \return Poco::SharedPtr<ConcurrencyLimiter> for the limiter (null if disabled).
+   */
+  Poco::SharedPtr<ConcurrencyLimiter> getConcurrencyLimiter()
+  {
+    return rws_client_.getConcurrencyLimiter();
+  }
+
+  /**
+   * \brief A method for retrieving statistics about the coalescing of identical concurrent HTTP GET requests.
+   *
+   * \return RWSClient::CoalescingStatistics containing the statistics.
+   */
+  RWSClient::CoalescingStatistics getCoalescingStatistics()
+  {
+    return rws_client_.getCoalescingStatistics();
+  }
+
+  /**
+   * \brief A method for accessing the cache for static, or slowly changing, resources (disabled by default).
+   *
+   * \return ResponseCache& referring to the cache.
+   */
+  ResponseCache& getResponseCache()
+  {
+    return rws_client_.getResponseCache();
+  }
+
+  /**
+   * \brief A method for setting a store for the session cookies, so that the session can be reused by other clients.
+   *
+   * \param p_session_store for the session store (a null pointer disables the store).
+   */
+  void setSessionStore(const Poco::SharedPtr<SessionStore>& p_session_store)
+  {
+    rws_client_.setSessionStore(p_session_store);
+  }
+
+  /**
+   * \brief A method for setting if the client should log out from the controller when it is destroyed.
+   *
+   * \param logout for indicating if the client should log out or not.
+   */
+  void setLogoutOnDestruction(const bool logout)
+  {
+    rws_client_.setLogoutOnDestruction(logout);
+  }
+
 protected:
   /**
    * \brief A method for comparing a single text content (from a XML document node) with a specific string value.
@@ -0,0 +1,343 @@
+/***********************************************************************************************************************
+ *
+ * Copyright (c) 2026, ABB Schweiz AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with
+ * or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer in the documentation
+ *      and/or other materials provided with the
+ *      distribution.
+ *    * Neither the name of ABB nor the names of its
+ *      contributors may be used to endorse or promote
+ *      products derived from this software without
+ *      specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ***********************************************************************************************************************
+ */
+
+#ifndef RWS_MODULE_DEPLOYER_H
+#define RWS_MODULE_DEPLOYER_H
+
+#include <functional>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "Poco/Foundation.h"
+#include "Poco/Mutex.h"
+
+#include "rws_state_machine_interface.h"
+
+namespace abb
+{
+namespace rws
+{
+/**
+ * \brief A class for deploying RAPID modules via the StateMachine AddIn, while skipping unchanged modules.
+ *
+ * Each module's content is identified by its SHA-1 hash. The hashes of the deployed modules are recorded in a local
+ * manifest (per robot controller), and/or in sidecar files next to the modules on the robot controller (i.e.
+ * "<module file>.sha1"). A module is only uploaded and (re)loaded if its hash differs from the recorded one, or if it
+ * is not loaded in its task.
+ *
+ * The changed modules are deployed in phases, where each phase works on all modules (and tasks) in parallel:
+ * 1. Upload the module files.
+ * 2. Unload the old module versions, and load the new ones. The StateMachine AddIn runs the routines of all tasks on
+ *    one signal, so the inputs of all tasks are set first, and then the routines are signaled once per round (one
+ *    module per task and round).
+ * 3. Verify that the modules are loaded, and record their hashes.
+ *
+ * Note: A module's name is assumed to be its file name without the extension (e.g. "my_module.sys").
+ */
+class ModuleDeployer
+{
+public:
+  /**
+   * \brief A struct for representing a RAPID module to deploy.
+   */
+  struct Module
+  {
+    /**
+     * \brief A constructor.
+     *
+     * \param task for the RAPID task to load the module into.
+     * \param filename for the module's file name on the robot controller (e.g. "my_module.sys").
+     * \param content for the module's content.
+     * \param directory for the module's directory on the robot controller.
+     */
+    Module(const std::string& task,
+           const std::string& filename,
+           const std::string& content,
+           const std::string& directory = SystemConstants::RWS::Identifiers::HOME_DIRECTORY)
+    :
+    task(task),
+    filename(filename),
+    content(content),
+    directory(directory)
+    {}
+
+    /**
+     * \brief The RAPID task to load the module into.
+     */
+    std::string task;
+
+    /**
+     * \brief The module's file name on the robot controller.
+     */
+    std::string filename;
+
+    /**
+     * \brief The module's content.
+     */
+    std::string content;
+
+    /**
+     * \brief The module's directory on the robot controller.
+     */
+    std::string directory;
+  };
+
+  /**
+   * \brief A struct for containing the deployer's configuration.
+   */
+  struct Configuration
+  {
+    /**
+     * \brief Path to the local manifest file (empty to not use a local manifest). Use one manifest per controller.
+     */
+    std::string manifest_path;
+
+    /**
+     * \brief Flag indicating if sidecar files (with the modules' hashes) are used on the robot controller.
+     */
+    bool use_sidecar_files;
+
+    /**
+     * \brief The maximum number of requests that are made concurrently.
+     */
+    size_t max_concurrent_requests;
+
+    /**
+     * \brief Time [microseconds] to wait for a module to be loaded (or unloaded) by the StateMachine AddIn.
+     */
+    Poco::Int64 load_timeout;
+
+    /**
+     * \brief Interval [microseconds] between the checks if the modules have been loaded (or unloaded).
+     */
+    Poco::Int64 poll_interval;
+
+    /**
+     * \brief A default constructor.
+     */
+    Configuration()
+    :
+    use_sidecar_files(true),
+    max_concurrent_requests(3),
+    load_timeout(10000000),
+    poll_interval(100000)
+    {}
+  };
+
+  /**
+   * \brief A struct for containing the result of a deployment.
+   */
+  struct Result
+  {
+    /**
+     * \brief Flag indicating if all modules were deployed (or were already up to date).
+     */
+    bool success;
+
+    /**
+     * \brief Number of modules that were uploaded and loaded.
+     */
+    size_t deployed_modules;
+
+    /**
+     * \brief Number of modules that were skipped, since they were unchanged and already loaded.
+     */
+    size_t skipped_modules;
+
+    /**
+     * \brief The modules (as "<task>:<file name>") that could not be deployed.
+     */
+    std::vector<std::string> failed_modules;
+
+    /**
+     * \brief A default constructor.
+     */
+    Result() : success(false), deployed_modules(0), skipped_modules(0) {}
+  };
+
+  /**
+   * \brief A constructor.
+   *
+   * \param rws_interface for the interface to the robot controller (it must outlive the deployer).
+   * \param configuration for the deployer's configuration.
+   */
+  ModuleDeployer(RWSStateMachineInterface& rws_interface, const Configuration& configuration = Configuration());
+
+  /**
+   * \brief A method for deploying RAPID modules (skipping the unchanged ones).
+   *
+   * Note: The RAPID program must be running, since the StateMachine AddIn (un)loads the modules.
+   *
+   * \param modules for the modules to deploy (at most one module per task and file name).
+   *
+   * \return Result containing the result.
+   */
+  Result deploy(const std::vector<Module>& modules);
+
+  /**
+   * \brief A method for computing the hash of a module's content.
+   *
+   * \param content for the module's content.
+   *
+   * \return std::string containing the SHA-1 hash (as hexadecimal digits).
+   */
+  static std::string computeHash(const std::string& content);
+
+private:
+  /**
+   * \brief A struct for the state of a module during a deployment.
+   */
+  struct Deployment
+  {
+    /**
+     * \brief A constructor.
+     *
+     * \param p_module for the module.
+     */
+    Deployment(const Module* p_module) : p_module(p_module), recorded(false), loaded(false), failed(false) {}
+
+    /**
+     * \brief The module.
+     */
+    const Module* p_module;
+
+    /**
+     * \brief The module's name (i.e. its file name without the extension).
+     */
+    std::string name;
+
+    /**
+     * \brief The module's path on the robot controller.
+     */
+    std::string path;
+
+    /**
+     * \brief The hash of the module's content.
+     */
+    std::string hash;
+
+    /**
+     * \brief Flag indicating if the hash matches the recorded one (i.e. the module's file is up to date).
+     */
+    bool recorded;
+
+    /**
+     * \brief Flag indicating if (a version of) the module is loaded in its task.
+     */
+    bool loaded;
+
+    /**
+     * \brief Flag indicating if the deployment has failed.
+     */
+    bool failed;
+  };
+
+  /**
+   * \brief A type for a manifest, which maps modules (as "<task>:<path>") to hashes.
+   */
+  typedef std::map<std::string, std::string> Manifest;
+
+  /**
+   * \brief A method for running tasks in parallel (limited by the configured number of concurrent requests).
+   *
+   * \param tasks for the tasks to run. The method returns when all of them have completed.
+   */
+  void runInParallel(const std::vector<std::function<void()> >& tasks);
+
+  /**
+   * \brief A method for (un)loading one module per task, via the StateMachine AddIn.
+   *
+   * \param round for the modules to (un)load (at most one per task).
+   * \param procedure for the RAPID procedure to run (i.e. "runModuleLoad" or "runModuleUnload").
+   * \param loaded for indicating if the modules should be loaded or unloaded afterwards.
+   */
+  void runModuleProcedure(const std::vector<Deployment*>& round, const std::string& procedure, const bool loaded);
+
+  /**
+   * \brief A method for retrieving the names of the modules loaded in a task.
+   *
+   * \param task for the RAPID task.
+   *
+   * \return std::set<std::string> containing the module names.
+   */
+  std::set<std::string> getLoadedModules(const std::string& task);
+
+  /**
+   * \brief A method for loading a manifest from a file.
+   *
+   * \param path for the manifest file's path.
+   *
+   * \return Manifest containing the loaded manifest (empty if the file is missing or cannot be read).
+   */
+  static Manifest loadManifest(const std::string& path);
+
+  /**
+   * \brief A method for saving a manifest to a file (atomically, via a temporary file).
+   *
+   * \param path for the manifest file's path.
+   * \param manifest for the manifest to save.
+   *
+   * \return bool indicating if the manifest was saved.
+   */
+  static bool saveManifest(const std::string& path, const Manifest& manifest);
+
+  /**
+   * \brief The interface to the robot controller.
+   */
+  RWSStateMachineInterface& rws_interface_;
+
+  /**
+   * \brief The deployer's configuration.
+   */
+  const Configuration configuration_;
+
+  /**
+   * \brief Mutex for protecting the deployment states, while requests are made in parallel.
+   */
+  Poco::Mutex mutex_;
+
+  /**
+   * \brief Static constant for the sidecar files' extension.
+   */
+  static const std::string SIDECAR_EXTENSION;
+};
+
+} // end namespace rws
+} // end namespace abb
+
+#endif
@@ -37,12 +37,30 @@
 #ifndef RWS_POCO_CLIENT_H
 #define RWS_POCO_CLIENT_H
 
+#include <functional>
+#include <map>
+#include <vector>
+
+#include "Poco/Buffer.h"
+#include "Poco/Condition.h"
 #include "Poco/Mutex.h"
 #include "Poco/Net/HTTPClientSession.h"
 #include "Poco/Net/HTTPCredentials.h"
 #include "Poco/Net/HTTPResponse.h"
+#include "Poco/Net/NetException.h"
 #include "Poco/Net/WebSocket.h"
 #include "Poco/SharedPtr.h"
+#include "Poco/Timestamp.h"
+
+#include "rws_adaptive_timeout.h"
+#include "rws_bandwidth_limiter.h"
+#include "rws_cancellation_token.h"
+#include "rws_circuit_breaker.h"
+#include "rws_concurrency_limiter.h"
+#include "rws_content_sink.h"
+#include "rws_content_source.h"
+#include "rws_retry_policy.h"
+#include "rws_session_store.h"
 
 namespace abb
 {
@@ -70,7 +88,10 @@ public:
       EXCEPTION_POCO_INVALID_ARGUMENT, ///< POCO invalid argument exception
       EXCEPTION_POCO_TIMEOUT,          ///< POCO timeout exception.
       EXCEPTION_POCO_NET,              ///< POCO net exception.
-      EXCEPTION_POCO_WEBSOCKET         ///< POCO WebSocket exception.
+      EXCEPTION_POCO_WEBSOCKET,        ///< POCO WebSocket exception.
+      CIRCUIT_OPEN,                    ///< The request was not sent, since the controller is deemed unresponsive.
+      TRANSFER_ABORTED,                ///< The transfer of streamed content was aborted (e.g. by a content sink).
+      CANCELLED                        ///< The request was cancelled (see CancellationToken).
     };
 
     /**
@@ -115,19 +136,33 @@ public:
           Poco::Net::HTTPResponse::HTTPStatus status;
 
           /**
-           * \brief Response header info.
+           * \brief Response header fields (shared between copies of the result).
            */
-          std::string header_info;
+          Poco::SharedPtr<const Poco::Net::NameValueCollection> p_header;
 
           /**
-           * \brief Response content.
+           * \brief Response content (shared between copies of the result, i.e. it is never copied).
            */
-          std::string content;
+          Poco::SharedPtr<const std::string> p_content;
 
           /**
            * \brief A default constructor.
            */
           ResponseInfo() : status(Poco::Net::HTTPResponse::HTTP_OK) {}
+
+          /**
+           * \brief A method for rendering the response header fields into a text string (on demand).
+           *
+           * \return std::string containing the header info, as "name=value" lines.
+           */
+          std::string getHeaderInfo() const;
+
+          /**
+           * \brief A method for accessing the response content.
+           *
+           * \return const std::string& referring to the content. An empty string is referred to if there is no content.
+           */
+          const std::string& getContent() const;
         };
 
         /**
@@ -152,14 +187,21 @@ public:
         int flags;
 
         /**
-         * \brief Content from a received WebSocket frame.
+         * \brief Content from a received WebSocket frame (shared between copies of the result).
          */
-        std::string frame_content;
+        Poco::SharedPtr<const std::string> p_frame_content;
 
         /**
          * \brief A default constructor.
          */
         WebSocketInfo() : flags(0) {};
+
+        /**
+         * \brief A method for accessing the received WebSocket frame's content.
+         *
+         * \return const std::string& referring to the content. An empty string is referred to if there is no content.
+         */
+        const std::string& getFrameContent() const;
       };
 
       /**
@@ -188,10 +230,15 @@ public:
      */
     POCOInfo poco_info;
 
+    /**
+     * \brief Duration of the communication [microseconds].
+     */
+    Poco::Int64 duration;
+
     /**
      * \brief A default constructor.
      */
-    POCOResult() : status(UNKNOWN) {};
+    POCOResult() : status(UNKNOWN), duration(0) {};
 
     /**
      * \brief A method for adding info from a HTTP request.
@@ -204,18 +251,24 @@ public:
     /**
      * \brief A method for adding info from a HTTP response.
      *
+     * Note: The content is taken over (shared) by the result, and it should not be modified afterwards.
+     *
      * \param response for the HTTP response.
-     * \param response_content for the HTTP response's content.
+     * \param p_response_content for the HTTP response's content.
      */
-    void addHTTPResponseInfo(const Poco::Net::HTTPResponse& response, const std::string& response_content = "");
+    void addHTTPResponseInfo(const Poco::Net::HTTPResponse& response,
+                             const Poco::SharedPtr<const std::string>& p_response_content =
+                               Poco::SharedPtr<const std::string>());
 
     /**
      * \brief A method for adding info from a received WebSocket frame.
      *
+     * Note: The content is taken over (shared) by the result, and it should not be modified afterwards.
+     *
      * \param flags for the received WebSocket frame's flags.
-     * \param frame_content for the received WebSocket frame's content.
+     * \param p_frame_content for the received WebSocket frame's content.
      */
-    void addWebSocketFrameInfo(const int flags, const std::string& frame_content);
+    void addWebSocketFrameInfo(const int flags, const Poco::SharedPtr<const std::string>& p_frame_content);
 
     /**
      * \brief A method to map the general status to a std::string.
@@ -242,9 +295,361 @@ public:
     std::string toString(const bool verbose = false, const size_t indent = 0) const;
   };
 
+  /**
+   * \brief A struct for containing statistics about the authentication round trips.
+   */
+  struct AuthenticationStatistics
+  {
+    /**
+     * \brief Number of authentication challenges (i.e. HTTP 401 responses) received.
+     */
+    Poco::UInt64 challenges;
+
+    /**
+     * \brief Number of requests sent with preemptive authorization (based on a cached challenge).
+     */
+    Poco::UInt64 preemptive_authorizations;
+
+    /**
+     * \brief Number of preemptive authorizations that were rejected (e.g. because of a stale nonce).
+     */
+    Poco::UInt64 rejected_preemptive_authorizations;
+
+    /**
+     * \brief Number of times that credentials were sent in response to a challenge (i.e. the number of logins).
+     */
+    Poco::UInt64 authentications;
+
+    /**
+     * \brief Number of challenges that were resolved by joining a session established by another thread.
+     */
+    Poco::UInt64 joined_authentications;
+
+    /**
+     * \brief Number of times that the session store failed to store or remove the session (see setSessionStore(...)).
+     */
+    Poco::UInt64 session_store_failures;
+
+    /**
+     * \brief A default constructor.
+     */
+    AuthenticationStatistics()
+    :
+    challenges(0),
+    preemptive_authorizations(0),
+    rejected_preemptive_authorizations(0),
+    authentications(0),
+    joined_authentications(0),
+    session_store_failures(0)
+    {}
+  };
+
+  /**
+   * \brief A struct for containing statistics about the coalescing of identical concurrent HTTP GET requests.
+   */
+  struct CoalescingStatistics
+  {
+    /**
+     * \brief Number of HTTP GET requests that were eligible for coalescing.
+     */
+    Poco::UInt64 requests;
+
+    /**
+     * \brief Number of HTTP GET requests that attached to an identical in-flight request (instead of being sent).
+     */
+    Poco::UInt64 coalesced_requests;
+
+    /**
+     * \brief A default constructor.
+     */
+    CoalescingStatistics() : requests(0), coalesced_requests(0) {}
+  };
+
+  /**
+   * \brief A class for representing the options of a request (or of an operation consisting of several requests).
+   *
+   * A timeout is converted into an absolute deadline when the options are created. The deadline then bounds all
+   * requests that are made with the options (including retries), rather than each request individually. I.e. create
+   * the options right before making the request(s).
+   */
+  class RequestOptions
+  {
+  public:
+    /**
+     * \brief A callback for reporting the progress of a content transfer.
+     *
+     * The arguments are the number of transferred bytes, and the total number of bytes (negative if unknown).
+     */
+    typedef std::function<void(const Poco::UInt64 transferred, const Poco::Int64 total)> ProgressHandler;
+
+    /**
+     * \brief An enum for specifying the priority of a request.
+     */
+    enum Priority
+    {
+      PRIORITY_BULK,   ///< Bulk traffic (e.g. file transfers), which yields to other requests.
+      PRIORITY_NORMAL, ///< Normal traffic.
+      PRIORITY_CONTROL ///< Control commands (e.g. stopping RAPID execution), which may use a reserved connection.
+    };
+
+    /**
+     * \brief A default constructor. The client's HTTP communication timeout is used for each request.
+     */
+    RequestOptions()
+    :
+    has_deadline_(false),
+    has_range_(false),
+    range_first_(0),
+    range_last_(-1),
+    priority_(PRIORITY_NORMAL),
+    has_priority_(false)
+    {}
+
+    /**
+     * \brief A constructor.
+     *
+     * \param timeout for the time [microseconds], counted from now, that the request(s) must be completed within.
+     */
+    explicit RequestOptions(const Poco::Int64 timeout)
+    :
+    deadline_(),
+    has_deadline_(true),
+    has_range_(false),
+    range_first_(0),
+    range_last_(-1),
+    priority_(PRIORITY_NORMAL),
+    has_priority_(false)
+    {
+      deadline_ += timeout;
+    }
+
+    /**
+     * \brief A constructor.
+     *
+     * \param deadline for the point in time that the request(s) must be completed before.
+     */
+    explicit RequestOptions(const Poco::Timestamp& deadline)
+    :
+    deadline_(deadline),
+    has_deadline_(true),
+    has_range_(false),
+    range_first_(0),
+    range_last_(-1),
+    priority_(PRIORITY_NORMAL),
+    has_priority_(false)
+    {}
+
+    /**
+     * \brief A method for checking if the options have a deadline.
+     *
+     * \return bool indicating if the options have a deadline.
+     */
+    bool hasDeadline() const { return has_deadline_; }
+
+    /**
+     * \brief A method for checking if the deadline has passed.
+     *
+     * \return bool indicating if the deadline has passed (always false without a deadline).
+     */
+    bool isExpired() const { return has_deadline_ && deadline_.isElapsed(0); }
+
+    /**
+     * \brief A method for getting the time remaining until the deadline.
+     *
+     * \param default_timeout for the time [microseconds] to return if the options have no deadline.
+     *
+     * \return Poco::Int64 containing the remaining time [microseconds] (zero or negative if the deadline has passed).
+     */
+    Poco::Int64 getRemainingTime(const Poco::Int64 default_timeout) const
+    {
+      return (has_deadline_ ? deadline_ - Poco::Timestamp() : default_timeout);
+    }
+
+    /**
+     * \brief A method for setting a callback that reports the progress of streamed content transfers.
+     *
+     * \param progress_handler for the callback (called from the thread making the request).
+     *
+     * \return RequestOptions& referring to the options (to allow chaining).
+     */
+    RequestOptions& setProgressHandler(const ProgressHandler& progress_handler)
+    {
+      progress_handler_ = progress_handler;
+      return *this;
+    }
+
+    /**
+     * \brief A method for retrieving the progress callback.
+     *
+     * \return const ProgressHandler& referring to the callback (empty if not set).
+     */
+    const ProgressHandler& getProgressHandler() const { return progress_handler_; }
+
+    /**
+     * \brief A method for requesting only a byte range of the content (for HTTP GET requests streamed into a sink).
+     *
+     * The sink receives the content starting at the range's first byte. If the server ignores the range (i.e. it
+     * sends the complete content), then the bytes before the range are discarded. If a validator is specified, and
+     * the server's current validator differs from it (i.e. the resource has changed), then the transfer is aborted.
+     *
+     * \param first for the range's first byte.
+     * \param last for the range's last byte (inclusive, negative for the end of the content).
+     * \param validator for the resource's entity tag, or last modification date (empty to skip the check).
+     *
+     * \return RequestOptions& referring to the options (to allow chaining).
+     */
+    RequestOptions& setRange(const Poco::UInt64 first, const Poco::Int64 last = -1, const std::string& validator = "")
+    {
+      has_range_ = true;
+      range_first_ = first;
+      range_last_ = last;
+      range_validator_ = validator;
+      return *this;
+    }
+
+    /**
+     * \brief A method for checking if the options request a byte range.
+     *
+     * \return bool indicating if a byte range is requested.
+     */
+    bool hasRange() const { return has_range_; }
+
+    /**
+     * \brief A method for retrieving the requested range's first byte.
+     *
+     * \return Poco::UInt64 containing the first byte.
+     */
+    Poco::UInt64 getRangeFirst() const { return range_first_; }
+
+    /**
+     * \brief A method for retrieving the requested range's last byte.
+     *
+     * \return Poco::Int64 containing the last byte (inclusive, negative for the end of the content).
+     */
+    Poco::Int64 getRangeLast() const { return range_last_; }
+
+    /**
+     * \brief A method for retrieving the requested range's validator.
+     *
+     * \return const std::string& referring to the validator (empty if not set).
+     */
+    const std::string& getRangeValidator() const { return range_validator_; }
+
+    /**
+     * \brief A method for setting the priority of the request(s).
+     *
+     * \param priority for the priority.
+     *
+     * \return RequestOptions& referring to the options (to allow chaining).
+     */
+    RequestOptions& setPriority(const Priority priority)
+    {
+      priority_ = priority;
+      has_priority_ = true;
+      return *this;
+    }
+
+    /**
+     * \brief A method for checking if a priority has been set explicitly.
+     *
+     * \return bool indicating if a priority has been set.
+     */
+    bool hasPriority() const { return has_priority_; }
+
+    /**
+     * \brief A method for retrieving the priority of the request(s).
+     *
+     * \return Priority containing the priority (normal if not set).
+     */
+    Priority getPriority() const { return priority_; }
+
+    /**
+     * \brief A method for setting a token, which can be used to cancel the request(s) while they are in progress.
+     *
+     * Note: Cancelled requests are neither retried, nor coalesced with identical requests.
+     *
+     * \param p_cancellation_token for the token (a null pointer removes the token).
+     *
+     * \return RequestOptions& referring to the options (to allow chaining).
+     */
+    RequestOptions& setCancellationToken(const Poco::SharedPtr<CancellationToken>& p_cancellation_token)
+    {
+      p_cancellation_token_ = p_cancellation_token;
+      return *this;
+    }
+
+    /**
+     * \brief A method for retrieving the cancellation token.
+     *
+     * \return const Poco::SharedPtr<CancellationToken>& referring to the token (null if not set).
+     */
+    const Poco::SharedPtr<CancellationToken>& getCancellationToken() const { return p_cancellation_token_; }
+
+    /**
+     * \brief A method for checking if the request(s) have been cancelled.
+     *
+     * \return bool indicating if the cancellation token (if any) has been cancelled.
+     */
+    bool isCancelled() const { return !p_cancellation_token_.isNull() && p_cancellation_token_->isCancelled(); }
+
+  private:
+    /**
+     * \brief The deadline (only valid if has_deadline_ is true).
+     */
+    Poco::Timestamp deadline_;
+
+    /**
+     * \brief Flag indicating if the options have a deadline.
+     */
+    bool has_deadline_;
+
+    /**
+     * \brief Callback for reporting the progress of streamed content transfers.
+     */
+    ProgressHandler progress_handler_;
+
+    /**
+     * \brief Flag indicating if a byte range is requested.
+     */
+    bool has_range_;
+
+    /**
+     * \brief The requested range's first byte.
+     */
+    Poco::UInt64 range_first_;
+
+    /**
+     * \brief The requested range's last byte (inclusive, negative for the end of the content).
+     */
+    Poco::Int64 range_last_;
+
+    /**
+     * \brief The requested range's validator (empty to skip the check).
+     */
+    std::string range_validator_;
+
+    /**
+     * \brief The priority of the request(s).
+     */
+    Priority priority_;
+
+    /**
+     * \brief Flag indicating if the priority has been set explicitly.
+     */
+    bool has_priority_;
+
+    /**
+     * \brief Token for cancelling the request(s) (null if not cancellable).
+     */
+    Poco::SharedPtr<CancellationToken> p_cancellation_token_;
+  };
+
   /**
    * \brief A constructor.
    *
+   * Note: Failed HTTP requests are retried according to a DefaultRetryPolicy (see setRetryPolicy(...)). The circuit
+   *       breaker, adaptive timeouts and adaptive concurrency limiting are disabled by default.
+   *
    * \param ip_address for the remote server's IP address.
    * \param port for the remote server's port.
    * \param username for the username to the remote server's authentication process.
@@ -255,12 +660,23 @@ public:
              const std::string& username,
              const std::string& password)
   :
-  http_client_session_(ip_address, port),
-  http_credentials_(username, password)
-  {
-    http_client_session_.setKeepAlive(true);
-    http_client_session_.setTimeout(Poco::Timespan(DEFAULT_HTTP_TIMEOUT));
-  }
+  ip_address_(ip_address),
+  port_(port),
+  http_timeout_(DEFAULT_HTTP_TIMEOUT),
+  connection_pool_size_(DEFAULT_CONNECTION_POOL_SIZE),
+  number_of_connections_(0),
+  pipelining_enabled_(false),
+  control_lane_enabled_(true),
+  control_connection_leased_(false),
+  control_requests_(0),
+  waiting_requests_(0),
+  p_retry_policy_(new DefaultRetryPolicy()),
+  p_bandwidth_limiter_(new BandwidthLimiter()),
+  p_controller_bandwidth_limiter_(BandwidthLimiter::getInstance(ip_address, port)),
+  authentication_(username, password),
+  websocket_buffer_(BUFFER_SIZE),
+  websocket_max_message_size_(DEFAULT_WEBSOCKET_MAX_MESSAGE_SIZE)
+  {}
 
   /**
    * \brief A destructor.
@@ -270,153 +686,1190 @@ public:
   /**
    * \brief A method for sending a HTTP GET request.
    *
+   * If request coalescing is enabled, and an identical request (i.e. for the same URI) is already in flight, then
+   * the request attaches to the in-flight request's result, instead of being sent (see setRequestCoalescingEnabled).
+   *
    * \param uri for the URI (path and query).
+   * \param options for the request's options (e.g. a deadline).
    *
    * \return POCOResult containing the result.
    */
-  POCOResult httpGet(const std::string& uri);
+  POCOResult httpGet(const std::string& uri, const RequestOptions& options = RequestOptions());
+
+  /**
+   * \brief A method for sending a burst of HTTP GET requests.
+   *
+   * If pipelining is enabled, then the requests are written back to back on one connection, and the responses are
+   * read in order. This turns N round trips into roughly one. Requests that could not be completed in pipelined mode
+   * (e.g. if the server closed the connection, required authentication, or answered with a retryable status) are
+   * resent one by one. The circuit breaker and the concurrency limiter treat the pipelined burst as one request
+   * (since it occupies one connection), and the retry policy applies to the requests that are resent.
+   *
+   * If pipelining is disabled, then the requests are simply sent one by one.
+   *
+   * \param uris for the URIs (paths and queries).
+   * \param options for the requests' options (e.g. a deadline for the whole burst).
+   *
+   * \return std::vector<POCOResult> containing the results (in the same order as the URIs).
+   */
+  std::vector<POCOResult> httpGet(const std::vector<std::string>& uris,
+                                  const RequestOptions& options = RequestOptions());
+
+  /**
+   * \brief A method for sending a HTTP GET request, and for streaming the response's content into a sink.
+   *
+   * The content of a successful (2xx) response is handed over to the sink in chunks, i.e. it is not buffered in the
+   * result. The memory usage is therefore bounded, regardless of the content's size. Other responses (e.g. errors)
+   * are buffered in the result as usual.
+   *
+   * Note: The request is only retried if no content has been written to the sink yet.
+   *
+   * \param uri for the URI (path and query).
+   * \param sink for the sink to write the content to.
+   * \param options for the request's options (e.g. a deadline, or a progress handler).
+   *
+   * \return POCOResult containing the result.
+   */
+  POCOResult httpGet(const std::string& uri, ContentSink& sink, const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for sending a HTTP POST request.
    *
    * \param uri for the URI (path and query).
    * \param content for the request's content.
+   * \param options for the request's options (e.g. a deadline).
    *
    * \return POCOResult containing the result.
    */
-  POCOResult httpPost(const std::string& uri, const std::string& content = "");
+  POCOResult httpPost(const std::string& uri,
+                      const std::string& content = "",
+                      const RequestOptions& options = RequestOptions());
 
   /**
    * \brief A method for sending a HTTP PUT request.
    *
    * \param uri for the URI (path and query).
    * \param content for the request's content.
+   * \param options for the request's options (e.g. a deadline).
    *
    * \return POCOResult containing the result.
    */
-  POCOResult httpPut(const std::string& uri, const std::string& content = "");
+  POCOResult httpPut(const std::string& uri,
+                     const std::string& content = "",
+                     const RequestOptions& options = RequestOptions());
 
   /**
-   * \brief A method for sending a HTTP DELETE request.
+   * \brief A method for sending a HTTP PUT request, with the content streamed from a source.
+   *
+   * The content is handed over to the connection in chunks, i.e. it is neither copied into a string, nor retained
+   * in the result (or in any log of it). The memory usage is therefore bounded, regardless of the content's size.
+   *
+   * Note: The request can only be resent (e.g. after an authentication challenge, or by a retry policy) if the
+   *       source can be rewound. Otherwise it fails with the TRANSFER_ABORTED status.
    *
    * \param uri for the URI (path and query).
+   * \param source for the source to read the content from.
+   * \param options for the request's options (e.g. a deadline, or a progress handler).
    *
    * \return POCOResult containing the result.
    */
-  POCOResult httpDelete(const std::string& uri);
+  POCOResult httpPut(const std::string& uri, ContentSource& source, const RequestOptions& options = RequestOptions());
 
   /**
-   * \brief A method for setting the HTTP communication timeout.
+   * \brief A method for sending a HTTP DELETE request.
    *
-   * \note This method resets the internal HTTP client session, causing the
-   *       RWS server (robot controller) to send a new cookie. The RWS
-   *       session id is not changed.
+   * \param uri for the URI (path and query).
+   * \param options for the request's options (e.g. a deadline).
    *
-   * \param timeout for the HTTP communication timeout [microseconds].
+   * \return POCOResult containing the result.
    */
-  void setHTTPTimeout(const Poco::Int64 timeout)
-  {
-    http_client_session_.setTimeout(Poco::Timespan(timeout));
-    http_client_session_.reset();
-  }
+  POCOResult httpDelete(const std::string& uri, const RequestOptions& options = RequestOptions());
 
   /**
-   * \brief A method for checking if the WebSocket exist.
+   * \brief A method for retrieving a resource's validator (for resuming transfers) from a HTTP response's header.
    *
-   * \return bool flag indicating if the WebSocket exist or not.
+   * \param header for the HTTP response's header.
+   *
+   * \return std::string containing the entity tag, or the last modification date (empty if neither is present).
    */
-  bool webSocketExist() { return !p_websocket_.isNull(); }
+  static std::string getValidator(const Poco::Net::NameValueCollection& header);
 
   /**
-   * \brief A method for connecting a WebSocket.
+   * \brief A method for parsing a HTTP Content-Range header's value (e.g. "bytes 0-499/1234" or "bytes *\/1234").
    *
-   * \param uri for the URI (path and query).
-   * \param protocol for the WebSocket protocol.
-   * \param timeout for the WebSocket communication timeout [microseconds].
+   * \param content_range for the header's value.
+   * \param first for the range's first byte (negative if unsatisfied).
+   * \param last for the range's last byte (negative if unsatisfied).
+   * \param total for the content's total length (negative if unknown).
    *
-   * \return POCOResult containing the result.
+   * \return bool indicating if the value could be parsed.
    */
-  POCOResult webSocketConnect(const std::string& uri, const std::string& protocol, const Poco::Int64 timeout);
+  static bool parseContentRange(const std::string& content_range,
+                                Poco::Int64& first,
+                                Poco::Int64& last,
+                                Poco::Int64& total);
 
   /**
-   * \brief A method for receiving a WebSocket frame.
-   *
-   * \return POCOResult containing the result.
+   * \brief Static constant for the HTTP Range header's name.
    */
-  POCOResult webSocketReceiveFrame();
+  static const std::string RANGE;
 
   /**
-   * \brief Forcibly shut down the websocket connection.
+   * \brief Static constant for the HTTP If-Range header's name.
+   */
+  static const std::string IF_RANGE;
+
+  /**
+   * \brief Static constant for the HTTP Content-Range header's name.
+   */
+  static const std::string CONTENT_RANGE;
+
+  /**
+   * \brief A method for setting the (default) HTTP communication timeout.
    *
-   * The connection is shut down immediately.
-   * Subsequently, the function will block until a current call to webSocketReceiveFrame() has finished,
-   * before cleaning up the local state.
+   * The timeout is applied to the pooled connections without closing them. Individual requests can override it, by
+   * specifying a deadline in their RequestOptions.
    *
-   * Note that since mutexes do not guarantee the order of acquisition for multiple contenders,
-   * it is undefined how many calls to webSocketReceiveFrame() will still attempt to use the shut down
-   * connection before the local state is cleaned. Those invocation will throw a runtime error.
+   * \param timeout for the HTTP communication timeout [microseconds].
    */
-  void webSocketShutdown();
+  void setHTTPTimeout(const Poco::Int64 timeout);
 
   /**
-   * \brief A method for retrieving a substring in a string.
+   * \brief A method for setting the maximum number of HTTP connections that can be used concurrently.
    *
-   * \param whole_string for the string containing the substring.
-   * \param substring_start start of the substring.
-   * \param substring_end end of the substring.
+   * Connections are opened lazily, i.e. a new connection is only opened if all existing connections are busy
+   * (and the limit has not been reached). Requests issued when all connections are busy wait for a free one.
    *
-   * \return string containing the substring.
+   * \param size for the maximum number of concurrent HTTP connections (at least one connection is always allowed).
    */
-  std::string findSubstringContent(const std::string& whole_string,
-                                   const std::string& substring_start,
-                                   const std::string& substring_end);
+  void setConnectionPoolSize(const size_t size);
 
-private:
   /**
-   * \brief A method for making a HTTP request.
+   * \brief A method for retrieving the maximum number of HTTP connections that can be used concurrently.
    *
-   * \param method for the request's method.
-   * \param uri for the URI (path and query).
+   * \return size_t containing the connection pool size.
+   */
+  size_t getConnectionPoolSize();
+
+  /**
+   * \brief A method for enabling/disabling preemptive authorization (enabled by default).
+   *
+   * Once a Digest challenge has been received (and answered), new sessions are requested with an authorization
+   * computed from the cached challenge (with an increased nonce count). This saves the HTTP 401 round trip. The
+   * challenge flow is only used if the server rejects the cached nonce.
+   *
+   * \param enabled for indicating if preemptive authorization should be used or not.
+   */
+  void setPreemptiveAuthentication(const bool enabled);
+
+  /**
+   * \brief A method for retrieving statistics about the authentication round trips.
+   *
+   * \return AuthenticationStatistics containing the statistics.
+   */
+  AuthenticationStatistics getAuthenticationStatistics();
+
+  /**
+   * \brief A method for setting a store for the session cookies, so that the session can be reused by other clients.
+   *
+   * If no session has been established yet, then the stored session for the same controller and user is adopted
+   * (if any). Established sessions are saved in the store, and removed from it when discarded (e.g. after logout).
+   * Failures of the store do not fail the requests, but they are counted (see AuthenticationStatistics).
+   *
+   * \param p_session_store for the session store (a null pointer disables the store).
+   */
+  void setSessionStore(const Poco::SharedPtr<SessionStore>& p_session_store);
+
+  /**
+   * \brief A method for setting the policy that decides if failed HTTP requests should be retried.
+   *
+   * Note: By default, a DefaultRetryPolicy is used. I.e. idempotent requests (e.g. HTTP GET) are attempted up to 3
+   *       times after transport failures and temporary server errors (HTTP 429, 502, 503 and 504), while
+   *       non-idempotent requests (e.g. HTTP POST) are only attempted up to 2 times, and only if the server refused
+   *       to process them (HTTP 429 and 503). Retries are delayed with jittered exponential backoff, and limited by a
+   *       retry budget.
+   *
+   * \param p_retry_policy for the retry policy (a null pointer disables retries).
+   */
+  void setRetryPolicy(const Poco::SharedPtr<RetryPolicy>& p_retry_policy);
+
+  /**
+   * \brief A method for setting the circuit breaker, which makes HTTP requests fail fast while the server is
+   * unresponsive.
+   *
+   * Requests with control priority (e.g. stopping RAPID execution) are never rejected by the circuit breaker, and
+   * do not affect its state.
+   *
+   * Note: The circuit breaker is disabled by default. Use the (process wide) circuit breaker for the remote server
+   *       (see CircuitBreaker::getInstance(...)), so that all clients to the server share its state.
+   *
+   * \param p_circuit_breaker for the circuit breaker (a null pointer disables the circuit breaker).
+   */
+  void setCircuitBreaker(const Poco::SharedPtr<CircuitBreaker>& p_circuit_breaker);
+
+  /**
+   * \brief A method for retrieving the circuit breaker, e.g. for checking its state.
+   *
+   * \return Poco::SharedPtr<CircuitBreaker> for the circuit breaker (null if disabled).
+   */
+  Poco::SharedPtr<CircuitBreaker> getCircuitBreaker();
+
+  /**
+   * \brief A method for enabling adaptive HTTP communication timeouts, derived from observed round-trip times.
+   *
+   * When enabled, requests without a deadline use a timeout based on the round-trip times observed for similar
+   * requests (see AdaptiveTimeout), instead of the fixed HTTP communication timeout. This detects an unresponsive
+   * server faster, without causing spurious timeouts for requests that are known to be slow.
+   *
+   * Note: Adaptive timeouts are disabled by default.
+   *
+   * \param p_adaptive_timeout for the adaptive timeout (a null pointer disables adaptive timeouts).
+   */
+  void setAdaptiveTimeout(const Poco::SharedPtr<AdaptiveTimeout>& p_adaptive_timeout);
+
+  /**
+   * \brief A method for retrieving the adaptive timeout.
+   *
+   * \return Poco::SharedPtr<AdaptiveTimeout> for the adaptive timeout (null if disabled).
+   */
+  Poco::SharedPtr<AdaptiveTimeout> getAdaptiveTimeout();
+
+  /**
+   * \brief A method for setting an adaptive concurrency limiter, which protects the server against overload.
+   *
+   * When enabled, each attempt of a HTTP request (except requests with control priority) needs a permit from the
+   * limiter, and reports its outcome to it (see ConcurrencyLimiter). Use the process wide limiter for the controller
+   * (see ConcurrencyLimiter::getInstance(...)), so that all clients to the controller share the limit.
+   *
+   * Note: Adaptive concurrency limiting is disabled by default.
+   *
+   * \param p_concurrency_limiter for the limiter (a null pointer disables the limiting).
+   */
+  void setConcurrencyLimiter(const Poco::SharedPtr<ConcurrencyLimiter>& p_concurrency_limiter);
+
+  /**
+   * \brief A method for retrieving the adaptive concurrency limiter (e.g. for inspecting the current limit).
+   *
+   * \return Poco::SharedPtr<ConcurrencyLimiter> for the limiter (null if disabled).
+   */
+  Poco::SharedPtr<ConcurrencyLimiter> getConcurrencyLimiter();
+
+  /**
+   * \brief A method for discarding the current session, e.g. after it has been logged out.
+   *
+   * The session cookies are removed from all connections (at their next use), and from the session store (if any).
+   */
+  void discardSession();
+
+  /**
+   * \brief A method for enabling/disabling HTTP/1.1 pipelining of GET request bursts (disabled by default).
+   *
+   * \param enabled for indicating if pipelining should be used or not.
+   */
+  void setPipeliningEnabled(const bool enabled);
+
+  /**
+   * \brief A method for enabling/disabling the reserved control connection (enabled by default).
+   *
+   * If enabled, then one connection (in addition to the pool) is reserved for requests with control priority, so
+   * that control commands never have to wait for a pooled connection (e.g. one leased by a long file transfer).
+   *
+   * \param enabled for indicating if a connection should be reserved for control requests or not.
+   */
+  void setControlLaneEnabled(const bool enabled);
+
+  /**
+   * \brief A method for setting the client's bandwidth limiter, which limits the client's bulk transfers.
+   *
+   * The limiter is unlimited by default, and its limit can be changed at any time (see BandwidthLimiter::setLimit).
+   *
+   * \param p_bandwidth_limiter for the limiter (a null pointer disables the client's limit).
+   */
+  void setBandwidthLimiter(const Poco::SharedPtr<BandwidthLimiter>& p_bandwidth_limiter);
+
+  /**
+   * \brief A method for retrieving the client's bandwidth limiter.
+   *
+   * \return Poco::SharedPtr<BandwidthLimiter> for the limiter (null if disabled).
+   */
+  Poco::SharedPtr<BandwidthLimiter> getBandwidthLimiter();
+
+  /**
+   * \brief A method for setting the controller's bandwidth limiter, which limits bulk transfers of all its clients.
+   *
+   * By default, the process wide limiter for the controller is used (see BandwidthLimiter::getInstance(...)).
+   *
+   * \param p_bandwidth_limiter for the limiter (a null pointer disables the controller's limit for this client).
+   */
+  void setControllerBandwidthLimiter(const Poco::SharedPtr<BandwidthLimiter>& p_bandwidth_limiter);
+
+  /**
+   * \brief A method for retrieving the controller's bandwidth limiter.
+   *
+   * \return Poco::SharedPtr<BandwidthLimiter> for the limiter (null if disabled).
+   */
+  Poco::SharedPtr<BandwidthLimiter> getControllerBandwidthLimiter();
+
+  /**
+   * \brief A method for enabling/disabling the coalescing of identical concurrent HTTP GET requests (disabled by
+   * default).
+   *
+   * A HTTP GET request for a URI that is already being requested (by another thread) attaches to that request's
+   * result, instead of being sent again. The results share the response's content, i.e. it is not copied.
+   *
+   * A request only attaches to an in-flight request that was started after the client's latest modifying request
+   * (e.g. a HTTP POST) completed, so a thread always observes the effects of its own modifications. It also only
+   * attaches if the in-flight request's deadline is not earlier than its own, and if it has the same priority.
+   * Control-priority requests are never coalesced, so that they always use the control connection.
+   *
+   * Note: An attached request gets a response that was produced under the in-flight request's options (e.g. its
+   * retries), which is why the coalescing is opt-in.
+   *
+   * \param enabled for indicating if identical concurrent HTTP GET requests should be coalesced or not.
+   */
+  void setRequestCoalescingEnabled(const bool enabled);
+
+  /**
+   * \brief A method for retrieving statistics about the coalescing of identical concurrent HTTP GET requests.
+   *
+   * \return CoalescingStatistics containing the statistics.
+   */
+  CoalescingStatistics getCoalescingStatistics();
+
+  /**
+   * \brief A method for checking if the WebSocket exist.
+   *
+   * \return bool flag indicating if the WebSocket exist or not.
+   */
+  bool webSocketExist() { return !p_websocket_.isNull(); }
+
+  /**
+   * \brief A method for connecting a WebSocket.
+   *
+   * \param uri for the URI (path and query).
+   * \param protocol for the WebSocket protocol.
+   * \param timeout for the WebSocket communication timeout [microseconds].
+   *
+   * \return POCOResult containing the result.
+   */
+  POCOResult webSocketConnect(const std::string& uri, const std::string& protocol, const Poco::Int64 timeout);
+
+  /**
+   * \brief A method for receiving a WebSocket message.
+   *
+   * A message that has been fragmented into several frames is reassembled (the result's flags are those of the
+   * message's first frame, with the FIN flag set). Ping frames are answered, and pong frames are ignored.
+   *
+   * \return POCOResult containing the result.
+   */
+  POCOResult webSocketReceiveFrame();
+
+  /**
+   * \brief A method for receiving a WebSocket message into a caller-provided buffer.
+   *
+   * Same as webSocketReceiveFrame(), except that the message's content is left in the buffer (i.e. it is not copied
+   * into the result). The buffer is resized to fit the message, and it can be reused for subsequent messages.
+   *
+   * \param buffer for the buffer to receive the message's content into.
+   *
+   * \return POCOResult containing the result.
+   */
+  POCOResult webSocketReceiveFrame(Poco::Buffer<char>& buffer);
+
+  /**
+   * \brief A method for sending a WebSocket ping frame, e.g. for checking if the peer is still alive.
+   *
+   * The peer's pong frame is consumed by webSocketReceiveFrame() (see webSocketLastFrameTime()).
+   *
+   * \return POCOResult containing the result.
+   */
+  POCOResult webSocketPing();
+
+  /**
+   * \brief A method for retrieving when the latest WebSocket frame (of any kind, e.g. a pong frame) was received.
+   *
+   * \return Poco::Timestamp containing the time (or the time of the connection, if no frame has been received).
+   */
+  Poco::Timestamp webSocketLastFrameTime();
+
+  /**
+   * \brief A method for setting the maximum size of a received WebSocket message.
+   *
+   * Larger messages are discarded, and reported as WebSocket exceptions.
+   *
+   * \param size for the maximum message size [bytes].
+   */
+  void setWebSocketMaxMessageSize(const size_t size);
+
+  /**
+   * \brief Forcibly shut down the websocket connection.
+   *
+   * The connection is shut down immediately.
+   * Subsequently, the function will block until a current call to webSocketReceiveFrame() has finished,
+   * before cleaning up the local state.
+   *
+   * Note that since mutexes do not guarantee the order of acquisition for multiple contenders,
+   * it is undefined how many calls to webSocketReceiveFrame() will still attempt to use the shut down
+   * connection before the local state is cleaned. Those invocation will throw a runtime error.
+   */
+  void webSocketShutdown();
+
+  /**
+   * \brief A method for retrieving a substring in a string.
+   *
+   * \param whole_string for the string containing the substring.
+   * \param substring_start start of the substring.
+   * \param substring_end end of the substring.
+   *
+   * \return string containing the substring.
+   */
+  std::string findSubstringContent(const std::string& whole_string,
+                                   const std::string& substring_start,
+                                   const std::string& substring_end);
+
+private:
+  /**
+   * \brief A struct for representing a pooled HTTP connection.
+   *
+   * Each connection is a keep-alive HTTP client session, with its own cookie state.
+   */
+  struct HTTPConnection
+  {
+    /**
+     * \brief A constructor.
+     *
+     * \param ip_address for the remote server's IP address.
+     * \param port for the remote server's port.
+     * \param timeout for the HTTP communication timeout [microseconds].
+     */
+    HTTPConnection(const std::string& ip_address, const Poco::UInt16 port, const Poco::Int64 timeout)
+    :
+    session(ip_address, port),
+    timeout(timeout),
+    cookies_version(0),
+    reserved(false),
+    priority(RequestOptions::PRIORITY_NORMAL),
+    cancelled(false)
+    {
+      session.setKeepAlive(true);
+      session.setTimeout(Poco::Timespan(timeout));
+    }
+
+    /**
+     * \brief A method for changing the HTTP communication timeout, without closing the connection.
+     *
+     * \param new_timeout for the HTTP communication timeout [microseconds].
+     */
+    void setTimeout(const Poco::Int64 new_timeout)
+    {
+      if (new_timeout != timeout)
+      {
+        // The session only applies its timeout when (re)connecting, so also update an established socket directly.
+        session.setTimeout(Poco::Timespan(new_timeout));
+
+        if (session.connected())
+        {
+          session.socket().setReceiveTimeout(Poco::Timespan(new_timeout));
+          session.socket().setSendTimeout(Poco::Timespan(new_timeout));
+        }
+
+        timeout = new_timeout;
+      }
+    }
+
+    /**
+     * \brief A method for sending a request's header, which (re)connects the session's socket if needed.
+     *
+     * The socket is only (re)connected while holding the connection's mutex, so that a concurrent shutdown() never
+     * acts on a socket that is being replaced. A connection that has been shut down is not reconnected.
+     *
+     * \param request for the request to send.
+     *
+     * \return std::ostream& reference to the stream for sending the request's content.
+     *
+     * \throw Poco::Net::NetException if the connection has been shut down to cancel its request(s).
+     */
+    std::ostream& sendRequest(Poco::Net::HTTPRequest& request)
+    {
+      // Lock the connection's mutex. It is released when the method goes out of scope.
+      Poco::ScopedLock<Poco::Mutex> lock(mutex);
+
+      if (cancelled)
+      {
+        throw Poco::Net::NetException("The connection has been shut down, since its request was cancelled");
+      }
+
+      return session.sendRequest(request);
+    }
+
+    /**
+     * \brief A method for closing the connection's socket (i.e. the session reconnects on its next request).
+     */
+    void reset()
+    {
+      // Lock the connection's mutex. It is released when the method goes out of scope.
+      Poco::ScopedLock<Poco::Mutex> lock(mutex);
+
+      session.reset();
+    }
+
+    /**
+     * \brief A method for shutting down the connection's socket (e.g. from another thread, to cancel a request).
+     *
+     * Blocked socket operations return, and the connection is not reconnected until it has been recovered. An ongoing
+     * (re)connection (see sendRequest()) is waited for, after which its socket is shut down.
+     */
+    void shutdown()
+    {
+      // Lock the connection's mutex. It is released when the method goes out of scope.
+      Poco::ScopedLock<Poco::Mutex> lock(mutex);
+
+      cancelled = true;
+
+      try
+      {
+        if (session.connected())
+        {
+          session.socket().shutdown();
+        }
+      }
+      catch (const Poco::Exception&)
+      {
+        // The socket has already been closed.
+      }
+    }
+
+    /**
+     * \brief A method for recovering a connection that has been shut down, by closing its socket.
+     *
+     * Note: Must only be called when nobody can shut down the connection anymore (e.g. when it is released).
+     */
+    void recover()
+    {
+      // Lock the connection's mutex. It is released when the method goes out of scope.
+      Poco::ScopedLock<Poco::Mutex> lock(mutex);
+
+      session.reset();
+      cancelled = false;
+    }
+
+    /**
+     * \brief The HTTP client session.
+     */
+    Poco::Net::HTTPClientSession session;
+
+    /**
+     * \brief The HTTP communication timeout [microseconds] that the session has been configured with.
+     */
+    Poco::Int64 timeout;
+
+    /**
+     * \brief A container for cookies received from the server, over this connection.
+     */
+    Poco::Net::NameValueCollection cookies;
+
+    /**
+     * \brief Version of the shared authentication cookies that the connection's cookies are based on.
+     */
+    unsigned int cookies_version;
+
+    /**
+     * \brief Flag indicating if the connection is the reserved control connection (i.e. not part of the pool).
+     */
+    bool reserved;
+
+    /**
+     * \brief The priority of the request(s) that the connection is currently leased for.
+     */
+    RequestOptions::Priority priority;
+
+    /**
+     * \brief A mutex for protecting the replacement of the session's socket, against a concurrent shutdown().
+     */
+    Poco::Mutex mutex;
+
+    /**
+     * \brief Flag indicating if the connection has been shut down (i.e. to cancel the request(s) it is leased for).
+     */
+    bool cancelled;
+  };
+
+  /**
+   * \brief A struct for representing the authentication context, which is shared by all pooled connections.
+   */
+  struct AuthenticationContext
+  {
+    /**
+     * \brief A constructor.
+     *
+     * \param username for the username to the remote server's authentication process.
+     * \param password for the password to the remote server's authentication process.
+     */
+    AuthenticationContext(const std::string& username, const std::string& password)
+    :
+    credentials(username, password),
+    cookies_version(0),
+    authenticating(false),
+    preemptive(true),
+    session_store_loaded(false)
+    {}
+
+    /**
+     * \brief A mutex for protecting the authentication context.
+     */
+    Poco::Mutex mutex;
+
+    /**
+     * \brief HTTP credentials for the remote server's access authentication process.
+     */
+    Poco::Net::HTTPCredentials credentials;
+
+    /**
+     * \brief The most recently established session cookies (adopted by connections that lack a session).
+     */
+    Poco::Net::NameValueCollection cookies;
+
+    /**
+     * \brief Version of the session cookies, which is increased every time the cookies are updated.
+     */
+    unsigned int cookies_version;
+
+    /**
+     * \brief Flag indicating if a thread is currently authenticating (only one thread is allowed at a time).
+     */
+    bool authenticating;
+
+    /**
+     * \brief A condition for waiting until an ongoing authentication has finished.
+     */
+    Poco::Condition condition;
+
+    /**
+     * \brief Flag indicating if preemptive authorization should be used.
+     */
+    bool preemptive;
+
+    /**
+     * \brief The most recent authorization header value (empty if no challenge has been answered yet).
+     */
+    std::string authorization;
+
+    /**
+     * \brief Statistics about the authentication round trips.
+     */
+    AuthenticationStatistics statistics;
+
+    /**
+     * \brief An optional store for sharing the session cookies with other clients.
+     */
+    Poco::SharedPtr<SessionStore> p_session_store;
+
+    /**
+     * \brief The key identifying the session in the session store.
+     */
+    std::string session_key;
+
+    /**
+     * \brief Flag indicating if the session store has been checked for a stored session.
+     */
+    bool session_store_loaded;
+  };
+
+  /**
+   * \brief A struct for representing a HTTP GET request in flight, which identical requests can attach to.
+   */
+  struct Flight
+  {
+    /**
+     * \brief A constructor.
+     *
+     * \param options for the options of the request in flight.
+     * \param generation for the coalescing context's generation when the request was started.
+     */
+    Flight(const RequestOptions& options, const Poco::UInt64 generation)
+    :
+    options(options),
+    generation(generation),
+    completed(false)
+    {}
+
+    /**
+     * \brief The options of the request in flight.
+     */
+    const RequestOptions options;
+
+    /**
+     * \brief The coalescing context's generation when the request was started.
+     */
+    const Poco::UInt64 generation;
+
+    /**
+     * \brief Flag indicating if the request has completed.
+     */
+    bool completed;
+
+    /**
+     * \brief The request's result (only valid once completed).
+     */
+    POCOResult result;
+  };
+
+  /**
+   * \brief A struct for representing the context for coalescing identical concurrent HTTP GET requests.
+   */
+  struct CoalescingContext
+  {
+    /**
+     * \brief A default constructor.
+     */
+    CoalescingContext() : enabled(false), generation(0) {}
+
+    /**
+     * \brief A mutex for protecting the coalescing context.
+     */
+    Poco::Mutex mutex;
+
+    /**
+     * \brief A condition for waiting until a request in flight has completed.
+     */
+    Poco::Condition condition;
+
+    /**
+     * \brief Flag indicating if identical concurrent HTTP GET requests should be coalesced.
+     */
+    bool enabled;
+
+    /**
+     * \brief Generation, which is increased every time a modifying request (e.g. a HTTP POST) has completed.
+     */
+    Poco::UInt64 generation;
+
+    /**
+     * \brief The HTTP GET requests in flight (mapped by URI).
+     */
+    std::map<std::string, Poco::SharedPtr<Flight> > flights;
+
+    /**
+     * \brief Statistics about the coalescing.
+     */
+    CoalescingStatistics statistics;
+  };
+
+  /**
+   * \brief A class for checking out a connection from the pool, which is returned when the object goes out of scope.
+   */
+  class ConnectionLease
+  {
+  public:
+    /**
+     * \brief A constructor. Blocks until a connection is available, or the deadline (if any) has passed.
+     *
+     * \param client for the client owning the connection pool.
+     * \param options for the options of the request(s) that the connection is leased for.
+     * \param timeout for the timeout [microseconds] to use without a deadline (zero for the client's default).
+     */
+    ConnectionLease(POCOClient& client, const RequestOptions& options = RequestOptions(), const Poco::Int64 timeout = 0)
+    :
+    client_(client),
+    p_connection_(client.acquireConnection(options, timeout)),
+    p_cancellation_token_(options.getCancellationToken())
+    {
+      if (!p_connection_.isNull() && !p_cancellation_token_.isNull())
+      {
+        // Cancelling shuts down the connection's socket, which makes blocked socket operations return.
+        // Note: The lease keeps the connection alive until the callback has been unregistered.
+        HTTPConnection* p_connection = p_connection_.get();
+        p_registration_ = new CancellationToken::Registration(p_cancellation_token_, [p_connection]()
+        {
+          p_connection->shutdown();
+        });
+      }
+    }
+
+    /**
+     * \brief A destructor.
+     */
+    ~ConnectionLease()
+    {
+      // Unregister first, so that the socket is not shut down after it has been returned to the pool.
+      p_registration_ = Poco::SharedPtr<CancellationToken::Registration>();
+
+      if (!p_connection_.isNull())
+      {
+        if (p_connection_->cancelled || (!p_cancellation_token_.isNull() && p_cancellation_token_->isCancelled()))
+        {
+          // Only the connection is affected, i.e. the session (and its cookies) remains valid on the server.
+          p_connection_->recover();
+        }
+
+        client_.releaseConnection(p_connection_);
+      }
+    }
+
+    /**
+     * \brief A method for checking if a connection was leased (i.e. that the deadline did not pass while waiting).
+     *
+     * \return bool indicating if a connection was leased.
+     */
+    bool isValid() const { return !p_connection_.isNull(); }
+
+    /**
+     * \brief A method for accessing the leased connection.
+     *
+     * \return HTTPConnection& reference to the connection.
+     */
+    HTTPConnection& connection() { return *p_connection_; }
+
+  private:
+    /**
+     * \brief The client owning the connection pool.
+     */
+    POCOClient& client_;
+
+    /**
+     * \brief The leased connection.
+     */
+    Poco::SharedPtr<HTTPConnection> p_connection_;
+
+    /**
+     * \brief The token for cancelling the request(s) that the connection is leased for (null if not cancellable).
+     */
+    Poco::SharedPtr<CancellationToken> p_cancellation_token_;
+
+    /**
+     * \brief Registration for shutting down the connection if the request(s) are cancelled (null if not cancellable).
+     */
+    Poco::SharedPtr<CancellationToken::Registration> p_registration_;
+  };
+
+  /**
+   * \brief A method for checking out a connection from the pool. Blocks until a connection is available.
+   *
+   * The connection's timeout is set to the time remaining until the deadline (or to the specified timeout).
+   *
+   * \param options for the options of the request(s) that the connection is checked out for.
+   * \param timeout for the timeout [microseconds] to use without a deadline (zero for the client's default).
+   *
+   * \return Poco::SharedPtr<HTTPConnection> containing the connection (null if the deadline passed while waiting).
+   */
+  Poco::SharedPtr<HTTPConnection> acquireConnection(const RequestOptions& options, const Poco::Int64 timeout);
+
+  /**
+   * \brief A method for returning a connection to the pool.
+   *
+   * \param p_connection for the connection to return.
+   */
+  void releaseConnection(Poco::SharedPtr<HTTPConnection> p_connection);
+
+  /**
+   * \brief A method for checking if a connection can be leased for a request of a certain priority.
+   *
+   * Note: The pool's mutex must be held by the caller.
+   *
+   * \param priority for the request's priority.
+   *
+   * \return bool indicating if a connection can be leased.
+   */
+  bool isConnectionAvailable(const RequestOptions::Priority priority);
+
+  /**
+   * \brief A method for pausing a bulk transfer (between two chunks) while control requests are in progress.
+   *
+   * The pause is bounded by MAX_BULK_PAUSE, and by the deadline (if any), to not let the transfer time out.
+   *
+   * \param options for the options of the bulk transfer.
+   */
+  void yieldToControlRequests(const RequestOptions& options);
+
+  /**
+   * \brief A method for pausing a bulk transfer, before a chunk is transferred, to respect the bandwidth limits.
+   *
+   * \param options for the options of the bulk transfer.
+   * \param size for the chunk's size [bytes].
+   */
+  void limitBandwidth(const RequestOptions& options, const size_t size);
+
+  /**
+   * \brief A method for classifying the outcome of a request, for the adaptive concurrency limiter.
+   *
+   * \param result for the request's result.
+   * \param options for the request's options.
+   *
+   * \return ConcurrencyLimiter::Outcome containing the outcome.
+   */
+  static ConcurrencyLimiter::Outcome classifyOutcome(const POCOResult& result, const RequestOptions& options);
+
+  /**
+   * \brief A method for making a HTTP request.
+   *
+   * \param method for the request's method.
+   * \param uri for the URI (path and query).
    * \param content for the request's content.
+   * \param options for the request's options.
+   * \param p_sink for an optional sink to stream the response's content into (null to buffer it in the result).
+   * \param p_source for an optional source to stream the request's content from (null to send the content string).
    *
    * \return POCOResult containing the result.
    */
   POCOResult makeHTTPRequest(const std::string& method,
                              const std::string& uri = "/",
-                             const std::string& content = "");
+                             const std::string& content = "",
+                             const RequestOptions& options = RequestOptions(),
+                             ContentSink* p_sink = 0,
+                             ContentSource* p_source = 0);
+
+  /**
+   * \brief A method for completing a HTTP GET request in flight, and for waking up the requests attached to it.
+   *
+   * \param uri for the URI (path and query).
+   * \param p_flight for the request in flight.
+   * \param result for the request's result.
+   */
+  void completeFlight(const std::string& uri, Poco::SharedPtr<Flight> p_flight, const POCOResult& result);
+
+  /**
+   * \brief A method for making a single attempt at a HTTP request (authenticating if needed).
+   *
+   * \param method for the request method.
+   * \param uri for the URI (path and query).
+   * \param content for the request's content.
+   * \param options for the request's options.
+   * \param timeout for the timeout [microseconds] to use without a deadline (zero for the client's default).
+   * \param p_sink for an optional sink to stream the response's content into (null to buffer it in the result).
+   * \param p_source for an optional source to stream the request's content from (null to send the content string).
+   *
+   * \return POCOResult containing the result.
+   */
+  POCOResult sendHTTPRequest(const std::string& method,
+                             const std::string& uri,
+                             const std::string& content,
+                             const RequestOptions& options,
+                             const Poco::Int64 timeout,
+                             ContentSink* p_sink,
+                             ContentSource* p_source);
+
+  /**
+   * \brief A method for making pipelined HTTP GET requests, as one request from the failure handling's point of view.
+   *
+   * The burst is admitted by the circuit breaker and the concurrency limiter (if any), and its outcome is recorded
+   * by them and by the adaptive timeout (if any). The completed requests count towards the retry policy's budget.
+   *
+   * \param uris for the URIs (paths and queries).
+   * \param results for the results (must have the same size as the URIs).
+   * \param first for the index of the first URI to send.
+   * \param options for the requests' options.
+   *
+   * \return size_t containing the index of the first URI whose request was not completed.
+   */
+  size_t makePipelinedHTTPRequests(const std::vector<std::string>& uris,
+                                   std::vector<POCOResult>& results,
+                                   size_t first,
+                                   const RequestOptions& options);
+
+  /**
+   * \brief A method for sending pipelined HTTP GET requests over one connection.
+   *
+   * \param uris for the URIs (paths and queries).
+   * \param results for the results (must have the same size as the URIs).
+   * \param first for the index of the first URI to send.
+   * \param options for the requests' options.
+   * \param timeout for the timeout [microseconds] to use without a deadline (zero for the client's default).
+   * \param outcome for the burst's outcome, i.e. its last response (with the round-trip time of its first
+   *                response), or the failure that ended it.
+   *
+   * \return size_t containing the index of the first URI whose request was not completed.
+   */
+  size_t sendPipelinedHTTPRequests(const std::vector<std::string>& uris,
+                                   std::vector<POCOResult>& results,
+                                   size_t first,
+                                   const RequestOptions& options,
+                                   const Poco::Int64 timeout,
+                                   POCOResult& outcome);
+
+  /**
+   * \brief A method for reading a HTTP response's content into a new buffer.
+   *
+   * The buffer is sized up front from the Content-Length header (if present), to avoid reallocations.
+   *
+   * \param response_stream for the HTTP response's content stream.
+   * \param response for the HTTP response.
+   *
+   * \return Poco::SharedPtr<std::string> containing the content.
+   */
+  static Poco::SharedPtr<std::string> readContent(std::istream& response_stream,
+                                                  const Poco::Net::HTTPResponse& response);
+
+  /**
+   * \brief A method for streaming a HTTP response's content into a sink, chunk by chunk.
+   *
+   * \param connection for the connection that the response is read from.
+   * \param response_stream for the HTTP response's content stream.
+   * \param response for the HTTP response.
+   * \param sink for the sink to write the content to.
+   * \param skip for the number of leading bytes to discard (instead of writing them to the sink).
+   *
+   * \throw Poco::Net::NetException (or Poco::TimeoutException) if the content could not be read completely.
+   * \throw Poco::IOException if the sink aborted the transfer.
+   */
+  static void streamContent(HTTPConnection& connection,
+                            std::istream& response_stream,
+                            const Poco::Net::HTTPResponse& response,
+                            ContentSink& sink,
+                            const Poco::UInt64 skip);
+
+  /**
+   * \brief A method for checking a HTTP response against the byte range requested by a HTTP request (if any).
+   *
+   * \param request for the HTTP request.
+   * \param response for the HTTP response.
+   *
+   * \return Poco::UInt64 containing the number of leading bytes to discard (if the server has ignored the range).
+   *
+   * \throw Poco::IOException if the response does not match the range, or if the resource has changed.
+   */
+  static Poco::UInt64 checkRange(const Poco::Net::HTTPRequest& request, const Poco::Net::HTTPResponse& response);
+
+  /**
+   * \brief A method for sending a HTTP request, with its content streamed from a source, chunk by chunk.
+   *
+   * Note: The content is sent with chunked transfer encoding, if the source does not know its length.
+   *
+   * \param connection for the connection to send the request on.
+   * \param request for the HTTP request.
+   * \param source for the source to read the content from.
+   *
+   * \throw Poco::Net::NetException (or Poco::TimeoutException) if the content could not be sent.
+   * \throw Poco::IOException if the source could not be (re)started, read, or did not match its length.
+   */
+  static void sendContent(HTTPConnection& connection, Poco::Net::HTTPRequest& request, ContentSource& source);
+
+  /**
+   * \brief A method for receiving (and reassembling) a WebSocket message.
+   *
+   * Note: The caller must hold websocket_use_mutex_.
+   *
+   * \param buffer for the buffer to receive the message's content into.
+   *
+   * \return POCOResult containing the result (without the message's content).
+   */
+  POCOResult receiveWebSocketMessage(Poco::Buffer<char>& buffer);
+
+  /**
+   * \brief A method for adding a preemptive authorization to a request, based on a cached challenge.
+   *
+   * \param request for the HTTP request.
+   *
+   * \return bool indicating if an authorization was added.
+   */
+  bool authorizePreemptively(Poco::Net::HTTPRequest& request);
 
   /**
    * \brief A method for sending and receiving HTTP messages.
    *
+   * \param connection for the connection to use.
+   * \param result for the result.
+   * \param request for the HTTP request.
+   * \param response for the HTTP response.
+   * \param request_content for the request's content.
+   * \param p_sink for an optional sink to stream a successful response's content into (null to buffer it).
+   * \param p_source for an optional source to stream the request's content from (null to send the content string).
+   */
+  void sendAndReceive(HTTPConnection& connection,
+                      POCOResult& result,
+                      Poco::Net::HTTPRequest& request,
+                      Poco::Net::HTTPResponse& response,
+                      const std::string& request_content,
+                      ContentSink* p_sink,
+                      ContentSource* p_source);
+
+  /**
+   * \brief A method for (re)establishing the session, after a request was rejected as unauthorized.
+   *
+   * Only one thread at a time authenticates. Threads whose requests were rejected meanwhile wait for it, and then
+   * resend their requests within the new session (instead of authenticating themselves).
+   *
+   * \param connection for the connection to use.
    * \param result for the result.
    * \param request for the HTTP request.
    * \param response for the HTTP response.
    * \param request_content for the request's content.
+   * \param cookies_version for the version of the shared session cookies that the rejected request was based on.
+   * \param p_sink for an optional sink to stream a successful response's content into (null to buffer it).
+   * \param p_source for an optional source to stream the request's content from (null to send the content string).
    */
-  void sendAndReceive(POCOResult& result,
+  void reauthenticate(HTTPConnection& connection,
+                      POCOResult& result,
                       Poco::Net::HTTPRequest& request,
                       Poco::Net::HTTPResponse& response,
-                      const std::string& request_content);
+                      const std::string& request_content,
+                      const unsigned int cookies_version,
+                      ContentSink* p_sink,
+                      ContentSource* p_source);
+
+  /**
+   * \brief A method for waiting for an ongoing authentication, and for then deciding if a new one is needed.
+   *
+   * \param connection for the connection that needs a session.
+   * \param cookies_version for the version of the shared session cookies that the rejected request was based on.
+   *
+   * \return bool indicating if the caller must authenticate (and then call endAuthentication()). If false, then a
+   *         newer session exists, and the connection has adopted it.
+   */
+  bool beginAuthentication(HTTPConnection& connection, const unsigned int cookies_version);
+
+  /**
+   * \brief A method for signaling that an authentication has finished (successfully or not).
+   */
+  void endAuthentication();
 
   /**
    * \brief A method for performing authentication.
    *
+   * \param connection for the connection to use.
    * \param result for the result.
    * \param request for the HTTP request.
    * \param response for the HTTP response.
    * \param request_content for the request's content.
+   * \param p_sink for an optional sink to stream a successful response's content into (null to buffer it).
+   * \param p_source for an optional source to stream the request's content from (null to send the content string).
    */
-  void authenticate(POCOResult& result,
+  void authenticate(HTTPConnection& connection,
+                    POCOResult& result,
                     Poco::Net::HTTPRequest& request,
                     Poco::Net::HTTPResponse& response,
-                    const std::string& request_content);
+                    const std::string& request_content,
+                    ContentSink* p_sink,
+                    ContentSource* p_source);
+
+  /**
+   * \brief A method for making a connection adopt the shared session cookies (if they have been updated).
+   *
+   * \param connection for the connection to update.
+   */
+  void adoptSharedCookies(HTTPConnection& connection);
+
+  /**
+   * \brief A method for publishing a connection's cookies as the shared session cookies.
+   *
+   * \param connection for the connection whose cookies to publish.
+   */
+  void publishSharedCookies(HTTPConnection& connection);
+
+  /**
+   * \brief A method for updating a connection's cookies from a response (and for publishing them, if any were sent).
+   *
+   * \param connection for the connection to update.
+   * \param response for the response, which may contain cookies.
+   */
+  void updateCookies(HTTPConnection& connection, const Poco::Net::HTTPResponse& response);
 
   /**
    * \brief A method for extracting and storing information from a cookie string.
    *
    * \param cookie_string for the cookie string.
+   * \param cookies for the container to store the cookie in.
    */
-  void extractAndStoreCookie(const std::string& cookie_string);
+  void extractAndStoreCookie(const std::string& cookie_string, Poco::Net::NameValueCollection& cookies);
 
   /**
    * \brief Static constant for the default HTTP communication timeout [microseconds].
@@ -424,14 +1877,139 @@ private:
   static const Poco::Int64 DEFAULT_HTTP_TIMEOUT = 400e3;
 
   /**
-   * \brief Static constant for the socket's buffer size.
+   * \brief Static constant for the default number of HTTP connections that can be used concurrently.
+   */
+  static const size_t DEFAULT_CONNECTION_POOL_SIZE = 4;
+
+  /**
+   * \brief Static constant for the maximum time that a bulk transfer pauses for control requests [microseconds].
+   */
+  static const Poco::Int64 MAX_BULK_PAUSE = 200e3;
+
+  /**
+   * \brief Static constant for the WebSocket buffer's initial capacity (it grows to fit larger messages).
    */
   static const size_t BUFFER_SIZE = 1024;
 
   /**
-   * \brief A mutex for protecting the clients's HTTP resources.
+   * \brief Static constant for the size of the chunks that streamed content is transferred in [bytes].
+   */
+  static const size_t STREAM_CHUNK_SIZE = 64 * 1024;
+
+  /**
+   * \brief Static constant for the default maximum size of a received WebSocket message [bytes].
+   */
+  static const size_t DEFAULT_WEBSOCKET_MAX_MESSAGE_SIZE = 16 * 1024 * 1024;
+
+  /**
+   * \brief The remote server's IP address.
+   */
+  const std::string ip_address_;
+
+  /**
+   * \brief The remote server's port.
+   */
+  const Poco::UInt16 port_;
+
+  /**
+   * \brief A mutex for protecting the client's connection pool.
+   */
+  Poco::Mutex pool_mutex_;
+
+  /**
+   * \brief A condition for signaling that a connection has been returned to the pool.
+   */
+  Poco::Condition pool_condition_;
+
+  /**
+   * \brief The HTTP communication timeout [microseconds].
+   */
+  Poco::Int64 http_timeout_;
+
+  /**
+   * \brief The maximum number of HTTP connections that can be used concurrently.
+   */
+  size_t connection_pool_size_;
+
+  /**
+   * \brief The number of currently open (idle or leased) HTTP connections.
+   */
+  size_t number_of_connections_;
+
+  /**
+   * \brief Flag indicating if bursts of HTTP GET requests should be pipelined.
+   */
+  bool pipelining_enabled_;
+
+  /**
+   * \brief Flag indicating if a connection is reserved for requests with control priority.
+   */
+  bool control_lane_enabled_;
+
+  /**
+   * \brief The reserved control connection, when idle (null if it is leased, or has not been opened yet).
+   */
+  Poco::SharedPtr<HTTPConnection> p_control_connection_;
+
+  /**
+   * \brief Flag indicating if the reserved control connection is currently leased.
+   */
+  bool control_connection_leased_;
+
+  /**
+   * \brief The number of connections currently leased for requests with control priority.
+   */
+  size_t control_requests_;
+
+  /**
+   * \brief The number of requests with normal priority that are waiting for a connection (bulk requests defer).
+   */
+  size_t waiting_requests_;
+
+  /**
+   * \brief The policy deciding if failed HTTP requests should be retried.
+   */
+  Poco::SharedPtr<RetryPolicy> p_retry_policy_;
+
+  /**
+   * \brief The circuit breaker for the remote server.
+   */
+  Poco::SharedPtr<CircuitBreaker> p_circuit_breaker_;
+
+  /**
+   * \brief The adaptive timeout (null if adaptive timeouts are disabled).
+   */
+  Poco::SharedPtr<AdaptiveTimeout> p_adaptive_timeout_;
+
+  /**
+   * \brief The adaptive concurrency limiter (null if adaptive concurrency limiting is disabled).
+   */
+  Poco::SharedPtr<ConcurrencyLimiter> p_concurrency_limiter_;
+
+  /**
+   * \brief The client's bandwidth limiter for bulk transfers (null if disabled).
+   */
+  Poco::SharedPtr<BandwidthLimiter> p_bandwidth_limiter_;
+
+  /**
+   * \brief The controller's bandwidth limiter for bulk transfers (null if disabled).
+   */
+  Poco::SharedPtr<BandwidthLimiter> p_controller_bandwidth_limiter_;
+
+  /**
+   * \brief Idle HTTP connections, ready to be leased.
+   */
+  std::vector<Poco::SharedPtr<HTTPConnection> > idle_connections_;
+
+  /**
+   * \brief The authentication context shared by all pooled connections.
+   */
+  AuthenticationContext authentication_;
+
+  /**
+   * \brief The context for coalescing identical concurrent HTTP GET requests.
    */
-  Poco::Mutex http_mutex_;
+  CoalescingContext coalescing_;
 
   /**
    * \brief A mutex for protecting the client's WebSocket pointer.
@@ -457,24 +2035,19 @@ private:
   Poco::Mutex websocket_use_mutex_;
 
   /**
-   * \brief A HTTP client session.
-   */
-  Poco::Net::HTTPClientSession http_client_session_;
-
-  /**
-   * \brief HTTP credentials for the remote server's access authentication process.
+   * \brief A buffer for a WebSocket (reused between messages).
    */
-  Poco::Net::HTTPCredentials http_credentials_;
+  Poco::Buffer<char> websocket_buffer_;
 
   /**
-   * \brief A container for cookies received from a server.
+   * \brief The maximum size of a received WebSocket message [bytes].
    */
-  Poco::Net::NameValueCollection cookies_;
+  size_t websocket_max_message_size_;
 
   /**
-   * \brief A buffer for a WebSocket.
+   * \brief The time when the latest WebSocket frame was received (protected by websocket_use_mutex_).
    */
-  char websocket_buffer_[BUFFER_SIZE];
+  Poco::Timestamp websocket_last_frame_time_;
 
   /**
    * \brief A pointer to a WebSocket client.
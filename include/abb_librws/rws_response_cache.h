@@ -0,0 +1,236 @@
+/***********************************************************************************************************************
+ *
+ * Copyright (c) 2026, ABB Schweiz AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with
+ * or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer in the documentation
+ *      and/or other materials provided with the
+ *      distribution.
+ *    * Neither the name of ABB nor the names of its
+ *      contributors may be used to endorse or promote
+ *      products derived from this software without
+ *      specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ***********************************************************************************************************************
+ */
+
+#ifndef RWS_RESPONSE_CACHE_H
+#define RWS_RESPONSE_CACHE_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Poco/AutoPtr.h"
+#include "Poco/DOM/Document.h"
+#include "Poco/Foundation.h"
+#include "Poco/Mutex.h"
+#include "Poco/Timestamp.h"
+
+namespace abb
+{
+namespace rws
+{
+/**
+ * \brief A class for caching the parsed responses of static, or slowly changing, RWS resources.
+ *
+ * The entries are keyed on the resources' URIs, and they expire after a time to live (TTL), which is configured per
+ * resource class. The cached documents are never handed out directly, i.e. each hit returns a private copy (which
+ * the caller is free to modify, and to use from any thread).
+ *
+ * Note: All TTLs are zero by default, i.e. nothing is cached until a TTL is configured. Resources that only change
+ *       on a restart, or a reconfiguration, of the robot controller can be given long TTLs, provided that the
+ *       cache is invalidated after such events (see the invalidate methods).
+ */
+class ResponseCache
+{
+public:
+  /**
+   * \brief An enum for specifying the classes of cacheable resources.
+   */
+  enum ResourceClass
+  {
+    CONTROLLER_SERVICE,          ///< The controller service (see RWSClient::getContollerService(...)).
+    CONFIGURATION,               ///< Configuration instances (see RWSClient::getConfigurationInstances(...)).
+    MECHANICAL_UNIT_STATIC_INFO, ///< Static mechanical unit info (see RWSClient::getMechanicalUnitStaticInfo(...)).
+    RAPID_TASKS,                 ///< The RAPID tasks (see RWSClient::getRAPIDTasks(...)).
+    ROBOTWARE_SYSTEM,            ///< The RobotWare system (see RWSClient::getRobotWareSystem(...)).
+    NUMBER_OF_RESOURCE_CLASSES   ///< The number of resource classes (not a resource class itself).
+  };
+
+  /**
+   * \brief A struct for containing statistics about the cache.
+   */
+  struct Statistics
+  {
+    /**
+     * \brief Number of lookups that were served from the cache.
+     */
+    Poco::UInt64 hits;
+
+    /**
+     * \brief Number of lookups that were not served from the cache (i.e. missing or expired entries).
+     */
+    Poco::UInt64 misses;
+
+    /**
+     * \brief A default constructor.
+     */
+    Statistics() : hits(0), misses(0) {}
+  };
+
+  /**
+   * \brief A default constructor.
+   */
+  ResponseCache();
+
+  /**
+   * \brief A method for setting the time to live of a resource class.
+   *
+   * \param resource_class for the resource class.
+   * \param ttl for the time to live [microseconds] (zero to not cache the resource class).
+   */
+  void setTTL(const ResourceClass resource_class, const Poco::Int64 ttl);
+
+  /**
+   * \brief A method for setting the time to live of all resource classes.
+   *
+   * \param ttl for the time to live [microseconds] (zero to disable the cache).
+   */
+  void setTTL(const Poco::Int64 ttl);
+
+  /**
+   * \brief A method for retrieving the time to live of a resource class.
+   *
+   * \param resource_class for the resource class.
+   *
+   * \return Poco::Int64 containing the time to live [microseconds].
+   */
+  Poco::Int64 getTTL(const ResourceClass resource_class);
+
+  /**
+   * \brief A method for looking up a cached response.
+   *
+   * \param resource_class for the resource's class.
+   * \param uri for the resource's URI.
+   * \param p_document for receiving a copy of the cached document (if found).
+   *
+   * \return bool indicating if an unexpired response was found.
+   */
+  bool lookup(const ResourceClass resource_class,
+              const std::string& uri,
+              Poco::AutoPtr<Poco::XML::Document>& p_document);
+
+  /**
+   * \brief A method for storing a response (a copy of it is stored, i.e. the caller keeps ownership of the document).
+   *
+   * \param resource_class for the resource's class.
+   * \param uri for the resource's URI.
+   * \param p_document for the parsed response.
+   */
+  void store(const ResourceClass resource_class,
+             const std::string& uri,
+             const Poco::AutoPtr<Poco::XML::Document>& p_document);
+
+  /**
+   * \brief A method for invalidating the cached response of one resource.
+   *
+   * \param uri for the resource's URI.
+   */
+  void invalidate(const std::string& uri);
+
+  /**
+   * \brief A method for invalidating the cached responses of a resource class (e.g. after a reconfiguration).
+   *
+   * \param resource_class for the resource class.
+   */
+  void invalidate(const ResourceClass resource_class);
+
+  /**
+   * \brief A method for invalidating all cached responses (e.g. after a restart of the robot controller).
+   */
+  void invalidateAll();
+
+  /**
+   * \brief A method for retrieving statistics about the cache.
+   *
+   * \return Statistics containing the statistics.
+   */
+  Statistics getStatistics();
+
+private:
+  /**
+   * \brief A struct for representing a cache entry.
+   */
+  struct Entry
+  {
+    /**
+     * \brief The resource's class.
+     */
+    ResourceClass resource_class;
+
+    /**
+     * \brief The point in time when the entry expires.
+     */
+    Poco::Timestamp expiry;
+
+    /**
+     * \brief The parsed response (only accessed while the cache's mutex is held).
+     */
+    Poco::AutoPtr<Poco::XML::Document> p_document;
+  };
+
+  /**
+   * \brief A method for copying a document.
+   *
+   * \param document for the document to copy.
+   *
+   * \return Poco::AutoPtr<Poco::XML::Document> containing the copy.
+   */
+  static Poco::AutoPtr<Poco::XML::Document> copy(Poco::XML::Document& document);
+
+  /**
+   * \brief Mutex for protecting the cache.
+   */
+  Poco::Mutex mutex_;
+
+  /**
+   * \brief The time to live [microseconds] of each resource class.
+   */
+  std::vector<Poco::Int64> ttls_;
+
+  /**
+   * \brief The cache entries (mapped by URI).
+   */
+  std::map<std::string, Entry> entries_;
+
+  /**
+   * \brief Statistics about the cache.
+   */
+  Statistics statistics_;
+};
+
+} // end namespace rws
+} // end namespace abb
+
+#endif
@@ -0,0 +1,224 @@
+/***********************************************************************************************************************
+ *
+ * Copyright (c) 2026, ABB Schweiz AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with
+ * or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer in the documentation
+ *      and/or other materials provided with the
+ *      distribution.
+ *    * Neither the name of ABB nor the names of its
+ *      contributors may be used to endorse or promote
+ *      products derived from this software without
+ *      specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ***********************************************************************************************************************
+ */
+
+#ifndef RWS_RETRY_POLICY_H
+#define RWS_RETRY_POLICY_H
+
+#include <string>
+
+#include "Poco/Mutex.h"
+#include "Poco/Net/HTTPResponse.h"
+#include "Poco/Random.h"
+
+namespace abb
+{
+namespace rws
+{
+/**
+ * \brief An interface for deciding if (and when) a failed HTTP request should be retried.
+ */
+class RetryPolicy
+{
+public:
+  /**
+   * \brief A struct for containing information about a failed attempt.
+   */
+  struct Attempt
+  {
+    /**
+     * \brief The HTTP request method.
+     */
+    std::string method;
+
+    /**
+     * \brief The number of attempts made so far (i.e. 1 after the first attempt).
+     */
+    unsigned int number;
+
+    /**
+     * \brief Flag indicating if the attempt failed at the transport level (e.g. a timeout or a lost connection).
+     */
+    bool transport_failure;
+
+    /**
+     * \brief The HTTP response status (only valid if it was not a transport failure).
+     */
+    Poco::Net::HTTPResponse::HTTPStatus status;
+
+    /**
+     * \brief A default constructor.
+     */
+    Attempt() : number(0), transport_failure(false), status(Poco::Net::HTTPResponse::HTTP_OK) {}
+  };
+
+  /**
+   * \brief A destructor.
+   */
+  virtual ~RetryPolicy() {}
+
+  /**
+   * \brief A method for notifying the policy about a new (first attempt of a) request, e.g. for budget accounting.
+   */
+  virtual void onRequest() {}
+
+  /**
+   * \brief A method for deciding if a failed attempt should be retried.
+   *
+   * \param attempt for the failed attempt.
+   *
+   * \return Poco::Int64 containing the delay before the retry [microseconds], or a negative value for no retry.
+   */
+  virtual Poco::Int64 getRetryDelay(const Attempt& attempt) = 0;
+
+  /**
+   * \brief A method for checking if a HTTP request method is idempotent (i.e. safe to repeat).
+   *
+   * \param method for the HTTP request method.
+   *
+   * \return bool indicating if the method is idempotent.
+   */
+  static bool isIdempotent(const std::string& method);
+};
+
+/**
+ * \brief A class for the default retry policy.
+ *
+ * Idempotent requests are retried after transport failures, and after server errors that indicate a temporary
+ * condition (HTTP 429, 502, 503 and 504). Non-idempotent requests are only retried when the server explicitly refused
+ * to process them (HTTP 429 and 503), since the request may otherwise already have taken effect.
+ *
+ * Retries are delayed with jittered exponential backoff, and limited by a retry budget: each request earns a fraction
+ * of a retry, and each retry spends one. This keeps retries from multiplying the load on an already loaded controller.
+ */
+class DefaultRetryPolicy : public RetryPolicy
+{
+public:
+  /**
+   * \brief A struct for containing the policy's configuration.
+   */
+  struct Configuration
+  {
+    /**
+     * \brief The maximum number of attempts (including the first) for idempotent requests.
+     */
+    unsigned int max_attempts_idempotent;
+
+    /**
+     * \brief The maximum number of attempts (including the first) for non-idempotent requests.
+     */
+    unsigned int max_attempts_non_idempotent;
+
+    /**
+     * \brief The backoff before the first retry (it is doubled for each retry) [microseconds].
+     */
+    Poco::Int64 base_backoff;
+
+    /**
+     * \brief The maximum backoff before a retry [microseconds].
+     */
+    Poco::Int64 max_backoff;
+
+    /**
+     * \brief The number of retries earned per request.
+     */
+    double budget_ratio;
+
+    /**
+     * \brief The maximum number of retries that can be saved up in the budget.
+     */
+    double max_budget;
+
+    /**
+     * \brief A default constructor.
+     */
+    Configuration()
+    :
+    max_attempts_idempotent(3),
+    max_attempts_non_idempotent(2),
+    base_backoff(20000),
+    max_backoff(500000),
+    budget_ratio(0.2),
+    max_budget(10.0)
+    {}
+  };
+
+  /**
+   * \brief A constructor.
+   *
+   * \param configuration for the policy's configuration.
+   */
+  explicit DefaultRetryPolicy(const Configuration& configuration = Configuration());
+
+  /**
+   * \brief A method for earning a fraction of a retry for a new request.
+   */
+  void onRequest();
+
+  /**
+   * \brief A method for deciding if a failed attempt should be retried.
+   *
+   * \param attempt for the failed attempt.
+   *
+   * \return Poco::Int64 containing the delay before the retry [microseconds], or a negative value for no retry.
+   */
+  Poco::Int64 getRetryDelay(const Attempt& attempt);
+
+private:
+  /**
+   * \brief The policy's configuration.
+   */
+  const Configuration configuration_;
+
+  /**
+   * \brief A mutex for protecting the budget and the random number generator.
+   */
+  Poco::Mutex mutex_;
+
+  /**
+   * \brief The current retry budget.
+   */
+  double budget_;
+
+  /**
+   * \brief Random number generator for the backoff jitter.
+   */
+  Poco::Random random_;
+};
+
+} // end namespace rws
+} // end namespace abb
+
+#endif
@@ -0,0 +1,236 @@
+/***********************************************************************************************************************
+ *
+ * Copyright (c) 2026, ABB Schweiz AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with
+ * or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer in the documentation
+ *      and/or other materials provided with the
+ *      distribution.
+ *    * Neither the name of ABB nor the names of its
+ *      contributors may be used to endorse or promote
+ *      products derived from this software without
+ *      specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ***********************************************************************************************************************
+ */
+
+#ifndef RWS_SESSION_STORE_H
+#define RWS_SESSION_STORE_H
+
+#include <map>
+#include <string>
+
+#include "Poco/Mutex.h"
+#include "Poco/Net/NameValueCollection.h"
+#include "Poco/Random.h"
+
+namespace abb
+{
+namespace rws
+{
+/**
+ * \brief An interface for storing RWS session cookies, so that a session can be reused by other clients.
+ *
+ * Sessions are identified by a key (see POCOClient::setSessionStore(...)), which identifies the controller and user.
+ *
+ * Note: Implementations must be safe to use from several threads (and clients) concurrently.
+ */
+class SessionStore
+{
+public:
+  /**
+   * \brief A destructor.
+   */
+  virtual ~SessionStore() {}
+
+  /**
+   * \brief A method for loading the cookies of a stored session.
+   *
+   * \param key for the session's key.
+   * \param cookies for containing the loaded cookies.
+   *
+   * \return bool indicating if a session was found.
+   */
+  virtual bool load(const std::string& key, Poco::Net::NameValueCollection& cookies) = 0;
+
+  /**
+   * \brief A method for storing the cookies of a session (replacing any previously stored cookies).
+   *
+   * \param key for the session's key.
+   * \param cookies for the cookies to store.
+   *
+   * \throw Poco::Exception if the session could not be stored.
+   */
+  virtual void save(const std::string& key, const Poco::Net::NameValueCollection& cookies) = 0;
+
+  /**
+   * \brief A method for removing a stored session (e.g. after logging out).
+   *
+   * \param key for the session's key.
+   *
+   * \throw Poco::Exception if the session could not be removed.
+   */
+  virtual void remove(const std::string& key) = 0;
+};
+
+/**
+ * \brief A class for storing sessions in memory, i.e. for sharing sessions between clients in the same process.
+ */
+class InProcessSessionStore : public SessionStore
+{
+public:
+  /**
+   * \brief A method for loading the cookies of a stored session (see SessionStore::load(...)).
+   *
+   * \param key for the session's key.
+   * \param cookies for containing the loaded cookies.
+   *
+   * \return bool indicating if a session was found.
+   */
+  bool load(const std::string& key, Poco::Net::NameValueCollection& cookies);
+
+  /**
+   * \brief A method for storing the cookies of a session (see SessionStore::save(...)).
+   *
+   * \param key for the session's key.
+   * \param cookies for the cookies to store.
+   */
+  void save(const std::string& key, const Poco::Net::NameValueCollection& cookies);
+
+  /**
+   * \brief A method for removing a stored session (see SessionStore::remove(...)).
+   *
+   * \param key for the session's key.
+   */
+  void remove(const std::string& key);
+
+private:
+  /**
+   * \brief A mutex for protecting the stored sessions.
+   */
+  Poco::Mutex mutex_;
+
+  /**
+   * \brief The stored sessions.
+   */
+  std::map<std::string, Poco::Net::NameValueCollection> sessions_;
+};
+
+/**
+ * \brief A class for storing sessions in a file, i.e. for reusing sessions across process restarts.
+ *
+ * The file is only readable and writable by its owner (on POSIX systems), since the cookies grant access to the
+ * controller. Elsewhere, it gets the default permissions of its directory, so it should be placed in a directory that
+ * only the user can access.
+ *
+ * The file is replaced atomically on every update, and it is reread on every load. Updates are serialized with an
+ * advisory lock on a lock file next to it ("<path>.lock"), so several processes can share the same file.
+ */
+class FileSessionStore : public SessionStore
+{
+public:
+  /**
+   * \brief A constructor.
+   *
+   * \param path for the path to the file (it is created on the first save).
+   */
+  explicit FileSessionStore(const std::string& path) : path_(path) { random_.seed(); }
+
+  /**
+   * \brief A method for loading the cookies of a stored session (see SessionStore::load(...)).
+   *
+   * \param key for the session's key.
+   * \param cookies for containing the loaded cookies.
+   *
+   * \return bool indicating if a session was found.
+   */
+  bool load(const std::string& key, Poco::Net::NameValueCollection& cookies);
+
+  /**
+   * \brief A method for storing the cookies of a session (see SessionStore::save(...)).
+   *
+   * \param key for the session's key.
+   * \param cookies for the cookies to store.
+   *
+   * \throw Poco::FileException if the file could not be locked or written.
+   */
+  void save(const std::string& key, const Poco::Net::NameValueCollection& cookies);
+
+  /**
+   * \brief A method for removing a stored session (see SessionStore::remove(...)).
+   *
+   * \param key for the session's key.
+   *
+   * \throw Poco::FileException if the file could not be locked or written.
+   */
+  void remove(const std::string& key);
+
+private:
+  /**
+   * \brief Static constant for the suffix of the lock file's path.
+   */
+  static const std::string LOCK_SUFFIX;
+
+  /**
+   * \brief A type for representing the stored sessions, as cookie strings ("name=value; ...") per key.
+   */
+  typedef std::map<std::string, std::string> Sessions;
+
+  /**
+   * \brief A method for reading all stored sessions from the file.
+   *
+   * \return Sessions containing the stored sessions (empty if the file does not exist).
+   */
+  Sessions read();
+
+  /**
+   * \brief A method for (atomically) writing all sessions to the file.
+   *
+   * Note: The caller must hold the file's lock.
+   *
+   * \param sessions for the sessions to write.
+   *
+   * \throw Poco::FileException if the file could not be written.
+   */
+  void write(const Sessions& sessions);
+
+  /**
+   * \brief The path to the file.
+   */
+  const std::string path_;
+
+  /**
+   * \brief A mutex for serializing the file accesses within the process.
+   */
+  Poco::Mutex mutex_;
+
+  /**
+   * \brief Random number generator for the temporary files' names (only used while holding the mutex).
+   */
+  Poco::Random random_;
+};
+
+} // end namespace rws
+} // end namespace abb
+
+#endif
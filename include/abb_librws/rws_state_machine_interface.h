@@ -1073,6 +1073,16 @@ private:
        */
       bool runMoveToCalibrationPosition(const std::string& task) const;
 
+      /**
+       * \brief Set the module file path for the predefined RAPID procedures "runModuleLoad" and "runModuleUnload".
+       *
+       * \param task specifying the RAPID task.
+       * \param file_path specifying file path to the module.
+       *
+       * \return bool indicating if the communication was successful or not.
+       */
+      bool setModuleFilePath(const std::string& task, const std::string& file_path) const;
+
       /**
        * \brief Set the move speed for the predefined RAPID procedures "runMoveAbsJ" and "runMoveJ".
        *
@@ -1639,10 +1649,12 @@ private:
    * \brief Toggles an IO signal.
    *
    * \param iosignal specifying the IO signal to toggle.
+   * \param options for the requests' options (e.g. a deadline, which covers all of the toggling's requests).
    *
    * \return bool indicating if the toggling was successful or not.
    */
-  bool toggleIOSignal(const std::string& iosignal);
+  bool toggleIOSignal(const std::string& iosignal,
+                      const RWSClient::RequestOptions& options = RWSClient::RequestOptions());
 
   /**
    * \brief Services provided by the StateMachine AddIn.
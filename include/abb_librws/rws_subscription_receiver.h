@@ -0,0 +1,589 @@
+/***********************************************************************************************************************
+ *
+ * Copyright (c) 2026, ABB Schweiz AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with
+ * or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer in the documentation
+ *      and/or other materials provided with the
+ *      distribution.
+ *    * Neither the name of ABB nor the names of its
+ *      contributors may be used to endorse or promote
+ *      products derived from this software without
+ *      specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ***********************************************************************************************************************
+ */
+
+#ifndef RWS_SUBSCRIPTION_RECEIVER_H
+#define RWS_SUBSCRIPTION_RECEIVER_H
+
+#include <atomic>
+#include <functional>
+#include <vector>
+
+#include "Poco/Buffer.h"
+#include "Poco/Event.h"
+#include "Poco/Mutex.h"
+#include "Poco/Random.h"
+#include "Poco/RunnableAdapter.h"
+#include "Poco/SharedPtr.h"
+#include "Poco/Thread.h"
+#include "Poco/Timestamp.h"
+
+#include "rws_client.h"
+
+namespace abb
+{
+namespace rws
+{
+/**
+ * \brief A class for receiving subscription events on a dedicated thread.
+ *
+ * The receiver owns the subscription's WebSocket read loop. Received events are decoded (parsed into XML documents)
+ * on the receiver thread, and pushed into a bounded single-producer/single-consumer queue, which is drained by a
+ * dispatcher thread that calls the registered callbacks. If the queue is full, then new events are dropped (and
+ * counted), so a slow callback never stalls the WebSocket.
+ *
+ * A silently lost WebSocket (e.g. a powered off controller, or a half-open TCP connection) only shows as receive
+ * timeouts. So, after a number of consecutive receive timeouts, the peer is pinged, and if nothing (e.g. its pong
+ * frame) has been received within the liveness timeout, then the WebSocket is deemed lost.
+ *
+ * If recovery is enabled, then a lost subscription is re-created automatically (with jittered exponential backoff
+ * between the attempts), and the current values of the subscribed resources are re-fetched and handed to the
+ * recovery callbacks, together with the duration of the gap in the event stream.
+ *
+ * Note: While the receiver is running, the client's waitForSubscriptionEvent() must not be used.
+ */
+class SubscriptionReceiver
+{
+public:
+  /**
+   * \brief A type for representing a callback, which is called (from the dispatcher thread) for each event.
+   */
+  typedef std::function<void(const RWSClient::RWSResult& event)> EventCallback;
+
+  /**
+   * \brief A struct for containing information about a recovered subscription.
+   */
+  struct Recovery
+  {
+    /**
+     * \brief Duration of the gap, from when the loss was detected until the subscription was re-created [microseconds].
+     */
+    Poco::Int64 gap_duration;
+
+    /**
+     * \brief Number of attempts needed to re-create the subscription.
+     */
+    unsigned int attempts;
+
+    /**
+     * \brief The subscribed resources' current values (in the same order as the subscribed resources).
+     */
+    std::vector<RWSClient::RWSResult> values;
+
+    /**
+     * \brief A default constructor.
+     */
+    Recovery() : gap_duration(0), attempts(0) {}
+  };
+
+  /**
+   * \brief A type for representing a callback, which is called (from the dispatcher thread) after each recovery.
+   *
+   * Note: It is called in order with the events, i.e. after all events received before the loss have been dispatched.
+   */
+  typedef std::function<void(const Recovery& recovery)> RecoveryCallback;
+
+  /**
+   * \brief A struct for containing the receiver's configuration.
+   */
+  struct Configuration
+  {
+    /**
+     * \brief The maximum number of events that can be queued for dispatching.
+     */
+    size_t queue_capacity;
+
+    /**
+     * \brief The receiver thread's priority.
+     */
+    Poco::Thread::Priority priority;
+
+    /**
+     * \brief The CPU that the receiver thread should be bound to (a negative value means no binding).
+     *
+     * Note: Only supported on Linux, and ignored elsewhere.
+     */
+    int cpu_affinity;
+
+    /**
+     * \brief Flag indicating if a lost subscription should be recovered automatically.
+     */
+    bool recovery_enabled;
+
+    /**
+     * \brief The backoff before the second recovery attempt (it is doubled for each failed attempt) [ms].
+     */
+    long min_backoff;
+
+    /**
+     * \brief The maximum backoff between recovery attempts [ms].
+     */
+    long max_backoff;
+
+    /**
+     * \brief The number of consecutive receive timeouts before the peer is pinged (zero disables the liveness check).
+     */
+    unsigned int liveness_timeouts;
+
+    /**
+     * \brief The time that a ping may stay unanswered before the WebSocket is deemed lost [ms].
+     *
+     * Note: It is checked when the next receive timeout occurs.
+     */
+    long liveness_timeout;
+
+    /**
+     * \brief A default constructor.
+     */
+    Configuration()
+    :
+    queue_capacity(DEFAULT_QUEUE_CAPACITY),
+    priority(Poco::Thread::PRIO_NORMAL),
+    cpu_affinity(-1),
+    recovery_enabled(false),
+    min_backoff(DEFAULT_MIN_BACKOFF),
+    max_backoff(DEFAULT_MAX_BACKOFF),
+    liveness_timeouts(DEFAULT_LIVENESS_TIMEOUTS),
+    liveness_timeout(DEFAULT_LIVENESS_TIMEOUT)
+    {}
+  };
+
+  /**
+   * \brief A struct for containing the receiver's statistics.
+   */
+  struct Statistics
+  {
+    /**
+     * \brief Number of received events.
+     */
+    Poco::UInt64 received_events;
+
+    /**
+     * \brief Number of events dispatched to the callbacks.
+     */
+    Poco::UInt64 dispatched_events;
+
+    /**
+     * \brief Number of events dropped because the queue was full.
+     */
+    Poco::UInt64 dropped_events;
+
+    /**
+     * \brief Number of events that could not be decoded.
+     */
+    Poco::UInt64 failed_events;
+
+    /**
+     * \brief Current number of queued events.
+     */
+    size_t queue_depth;
+
+    /**
+     * \brief Highest number of queued events observed.
+     */
+    size_t max_queue_depth;
+
+    /**
+     * \brief Number of times the subscription has been recovered.
+     */
+    Poco::UInt64 recoveries;
+
+    /**
+     * \brief Duration of the latest gap in the event stream [microseconds].
+     */
+    Poco::Int64 last_gap_duration;
+
+    /**
+     * \brief Accumulated duration of all gaps in the event stream [microseconds].
+     */
+    Poco::Int64 total_gap_duration;
+  };
+
+  /**
+   * \brief A constructor.
+   *
+   * \param rws_client for the client to receive subscription events with.
+   * \param configuration for the receiver's configuration.
+   */
+  SubscriptionReceiver(RWSClient& rws_client, const Configuration& configuration = Configuration());
+
+  /**
+   * \brief A destructor (stops the receiver, if it is running).
+   */
+  ~SubscriptionReceiver();
+
+  /**
+   * \brief A method for registering a callback for subscription events.
+   *
+   * \param callback for the callback.
+   */
+  void addCallback(const EventCallback& callback);
+
+  /**
+   * \brief A method for registering a callback for subscription recoveries.
+   *
+   * \param callback for the callback.
+   */
+  void addRecoveryCallback(const RecoveryCallback& callback);
+
+  /**
+   * \brief A method for starting a subscription, and the threads that receive and dispatch its events.
+   *
+   * \param resources specifying the resources to subscribe to.
+   *
+   * \return RWSClient::RWSResult containing the result of starting the subscription.
+   */
+  RWSClient::RWSResult start(const RWSClient::SubscriptionResources& resources);
+
+  /**
+   * \brief A method for ending the subscription, and stopping the threads (already queued events are dispatched).
+   */
+  void stop();
+
+  /**
+   * \brief A method for checking if the receiver is running.
+   *
+   * Note: Unless recovery is enabled, the receiver stops on its own if the subscription's WebSocket is lost.
+   *
+   * \return bool indicating if the receiver thread is running.
+   */
+  bool isRunning() const { return receiving_; }
+
+  /**
+   * \brief A method for retrieving the receiver's statistics.
+   *
+   * \return Statistics containing the statistics.
+   */
+  Statistics getStatistics() const;
+
+  /**
+   * \brief Static constant for the default maximum number of queued events.
+   */
+  static const size_t DEFAULT_QUEUE_CAPACITY = 256;
+
+  /**
+   * \brief Static constant for the default backoff before the second recovery attempt [ms].
+   */
+  static const long DEFAULT_MIN_BACKOFF = 100;
+
+  /**
+   * \brief Static constant for the default maximum backoff between recovery attempts [ms].
+   */
+  static const long DEFAULT_MAX_BACKOFF = 10000;
+
+  /**
+   * \brief Static constant for the default number of consecutive receive timeouts before the peer is pinged.
+   */
+  static const unsigned int DEFAULT_LIVENESS_TIMEOUTS = 1;
+
+  /**
+   * \brief Static constant for the default time that a ping may stay unanswered [ms].
+   */
+  static const long DEFAULT_LIVENESS_TIMEOUT = 10000;
+
+private:
+  /**
+   * \brief A struct for an item in the queue, i.e. either an event or a recovery.
+   */
+  struct QueueItem
+  {
+    /**
+     * \brief The event (if the item is not a recovery).
+     */
+    RWSClient::RWSResult event;
+
+    /**
+     * \brief The recovery (if the item is a recovery).
+     */
+    Poco::SharedPtr<Recovery> p_recovery;
+  };
+
+  /**
+   * \brief Static constant for how long the idle dispatcher thread waits before it rechecks the stop flag [ms].
+   */
+  static const long DISPATCHER_IDLE_WAIT = 100;
+
+  /**
+   * \brief The receiver thread's main loop.
+   */
+  void receive();
+
+  /**
+   * \brief The dispatcher thread's main loop.
+   */
+  void dispatch();
+
+  /**
+   * \brief A method for receiving and decoding one event.
+   *
+   * \param event for containing the decoded event.
+   *
+   * \return bool indicating if the subscription is still alive (a timeout does not count as a loss, unless the
+   *         liveness check fails).
+   */
+  bool receiveEvent(RWSClient::RWSResult& event);
+
+  /**
+   * \brief A method for checking the peer's liveness after a receive timeout (pinging it, if needed).
+   *
+   * \return bool indicating if the WebSocket is still deemed alive.
+   */
+  bool checkLiveness();
+
+  /**
+   * \brief A method for resetting the liveness check's state (e.g. when a new WebSocket has been created).
+   */
+  void resetLiveness();
+
+  /**
+   * \brief A method for recovering a lost subscription (called by the receiver thread).
+   *
+   * Note: The subscription is only ever (re)created and ended by the receiver thread while it is running, since the
+   * client's subscription state is not synchronized.
+   *
+   * \return bool indicating if the subscription was recovered, or if the receiver was stopped before that.
+   */
+  bool recover();
+
+  /**
+   * \brief A method for fetching the current values of the subscribed resources.
+   *
+   * \param options for the requests' options.
+   *
+   * \return std::vector<RWSClient::RWSResult> containing the values.
+   */
+  std::vector<RWSClient::RWSResult> fetchValues(const RWSClient::RequestOptions& options);
+
+  /**
+   * \brief A method for decoding a received message into an event.
+   *
+   * \param content for the message's content.
+   * \param size for the message's size.
+   * \param event for containing the decoded event.
+   *
+   * \return bool indicating if the message could be decoded.
+   */
+  static bool decode(const char* content, const size_t size, RWSClient::RWSResult& event);
+
+  /**
+   * \brief A method for pushing an item into the queue (only called by the receiver thread).
+   *
+   * \param item for the item (it is moved into the queue).
+   *
+   * \return bool indicating if the item was queued, or if it was dropped because the queue was full.
+   */
+  bool push(QueueItem& item);
+
+  /**
+   * \brief A method for popping an item from the queue (only called by the dispatcher thread).
+   *
+   * \param item for containing the popped item.
+   *
+   * \return bool indicating if an item was popped, or if the queue was empty.
+   */
+  bool pop(QueueItem& item);
+
+  /**
+   * \brief A method for binding the calling thread to the configured CPU (if any).
+   */
+  void applyAffinity();
+
+  /**
+   * \brief The client used for the subscription.
+   */
+  RWSClient& rws_client_;
+
+  /**
+   * \brief The receiver's configuration.
+   */
+  const Configuration configuration_;
+
+  /**
+   * \brief A mutex for protecting the start and stop sequences.
+   */
+  Poco::Mutex state_mutex_;
+
+  /**
+   * \brief A mutex for protecting the callbacks.
+   */
+  Poco::Mutex callbacks_mutex_;
+
+  /**
+   * \brief The registered callbacks.
+   */
+  std::vector<EventCallback> callbacks_;
+
+  /**
+   * \brief The registered recovery callbacks.
+   */
+  std::vector<RecoveryCallback> recovery_callbacks_;
+
+  /**
+   * \brief The subscribed resources (kept for recreating the subscription).
+   */
+  RWSClient::SubscriptionResources resources_;
+
+  /**
+   * \brief The queue's slots.
+   */
+  std::vector<QueueItem> queue_;
+
+  /**
+   * \brief Total number of events popped from the queue (only advanced by the dispatcher thread).
+   */
+  std::atomic<Poco::UInt64> queue_head_;
+
+  /**
+   * \brief Total number of events pushed into the queue (only advanced by the receiver thread).
+   */
+  std::atomic<Poco::UInt64> queue_tail_;
+
+  /**
+   * \brief An event for waking up the dispatcher thread.
+   */
+  Poco::Event queue_event_;
+
+  /**
+   * \brief A buffer for receiving WebSocket messages (only used by the receiver thread).
+   */
+  Poco::Buffer<char> buffer_;
+
+  /**
+   * \brief Flag indicating if the receiver has been asked to stop.
+   */
+  std::atomic<bool> stopping_;
+
+  /**
+   * \brief An event for interrupting a recovery backoff when the receiver is asked to stop.
+   */
+  Poco::Event stop_event_;
+
+  /**
+   * \brief A token for cancelling the receiver thread's requests (e.g. during a recovery) when it is asked to stop.
+   *
+   * Note: A new token is created every time the receiver is started (i.e. while the receiver thread is not running).
+   */
+  Poco::SharedPtr<CancellationToken> p_cancellation_token_;
+
+  /**
+   * \brief Random number generator for the backoff jitter (only used by the receiver thread).
+   */
+  Poco::Random random_;
+
+  /**
+   * \brief Number of consecutive receive timeouts since the latest received frame or ping (receiver thread only).
+   */
+  unsigned int consecutive_timeouts_;
+
+  /**
+   * \brief Flag indicating if a ping is waiting for an answer (only used by the receiver thread).
+   */
+  bool ping_outstanding_;
+
+  /**
+   * \brief The time when the latest ping was sent (only used by the receiver thread).
+   */
+  Poco::Timestamp ping_time_;
+
+  /**
+   * \brief Flag indicating if the receiver thread is running.
+   */
+  std::atomic<bool> receiving_;
+
+  /**
+   * \brief Number of received events.
+   */
+  std::atomic<Poco::UInt64> received_events_;
+
+  /**
+   * \brief Number of dispatched events.
+   */
+  std::atomic<Poco::UInt64> dispatched_events_;
+
+  /**
+   * \brief Number of dropped events.
+   */
+  std::atomic<Poco::UInt64> dropped_events_;
+
+  /**
+   * \brief Number of events that could not be decoded.
+   */
+  std::atomic<Poco::UInt64> failed_events_;
+
+  /**
+   * \brief Highest observed queue depth.
+   */
+  std::atomic<size_t> max_queue_depth_;
+
+  /**
+   * \brief Number of recoveries.
+   */
+  std::atomic<Poco::UInt64> recoveries_;
+
+  /**
+   * \brief Duration of the latest gap [microseconds].
+   */
+  std::atomic<Poco::Int64> last_gap_duration_;
+
+  /**
+   * \brief Accumulated duration of all gaps [microseconds].
+   */
+  std::atomic<Poco::Int64> total_gap_duration_;
+
+  /**
+   * \brief Adapter for running the receiver loop in the receiver thread.
+   */
+  Poco::RunnableAdapter<SubscriptionReceiver> receiver_runnable_;
+
+  /**
+   * \brief Adapter for running the dispatcher loop in the dispatcher thread.
+   */
+  Poco::RunnableAdapter<SubscriptionReceiver> dispatcher_runnable_;
+
+  /**
+   * \brief The receiver thread.
+   */
+  Poco::Thread receiver_thread_;
+
+  /**
+   * \brief The dispatcher thread.
+   */
+  Poco::Thread dispatcher_thread_;
+};
+
+} // end namespace rws
+} // end namespace abb
+
+#endif
@@ -0,0 +1,159 @@
+/***********************************************************************************************************************
+ *
+ * Copyright (c) 2026, ABB Schweiz AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with
+ * or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer in the documentation
+ *      and/or other materials provided with the
+ *      distribution.
+ *    * Neither the name of ABB nor the names of its
+ *      contributors may be used to endorse or promote
+ *      products derived from this software without
+ *      specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ***********************************************************************************************************************
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "abb_librws/rws_adaptive_timeout.h"
+
+namespace abb
+{
+namespace rws
+{
+/***********************************************************************************************************************
+ * Class definitions: AdaptiveTimeout
+ */
+
+const double AdaptiveTimeout::BUCKET_GROWTH = 1.25;
+
+/************************************************************
+ * Primary methods
+ */
+
+AdaptiveTimeout::AdaptiveTimeout(const Configuration& configuration)
+:
+configuration_(configuration)
+{}
+
+Poco::Int64 AdaptiveTimeout::getTimeout(const std::string& endpoint_class, const Poco::Int64 default_timeout)
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  Poco::ScopedLock<Poco::Mutex> lock(mutex_);
+
+  std::map<std::string, Histogram>::const_iterator it = histograms_.find(endpoint_class);
+
+  if (it == histograms_.end() || it->second.samples < configuration_.min_samples)
+  {
+    return default_timeout;
+  }
+
+  const Histogram& histogram = it->second;
+
+  // Find the (upper bound of the) bucket that contains the percentile.
+  const double target = configuration_.percentile * histogram.samples;
+  unsigned int accumulated = 0;
+  size_t bucket = 0;
+
+  for (; bucket < NUMBER_OF_BUCKETS - 1; ++bucket)
+  {
+    accumulated += histogram.buckets[bucket];
+
+    if (accumulated >= target)
+    {
+      break;
+    }
+  }
+
+  Poco::Int64 timeout = static_cast<Poco::Int64>(getUpperBound(bucket) * configuration_.margin_factor) +
+                        configuration_.margin;
+
+  return std::min(std::max(timeout, configuration_.min_timeout), configuration_.max_timeout);
+}
+
+void AdaptiveTimeout::record(const std::string& endpoint_class, const Poco::Int64 rtt)
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  Poco::ScopedLock<Poco::Mutex> lock(mutex_);
+
+  Histogram& histogram = histograms_[endpoint_class];
+
+  ++histogram.buckets[getBucket(rtt)];
+  ++histogram.samples;
+
+  // Age the observations, so that recent ones dominate.
+  if (histogram.samples >= configuration_.window)
+  {
+    histogram.samples = 0;
+
+    for (size_t i = 0; i < NUMBER_OF_BUCKETS; ++i)
+    {
+      histogram.buckets[i] /= 2;
+      histogram.samples += histogram.buckets[i];
+    }
+  }
+}
+
+/************************************************************
+ * Auxiliary methods
+ */
+
+std::string AdaptiveTimeout::classify(const std::string& method, const std::string& uri)
+{
+  // Only consider the path, and at most its first two segments.
+  size_t end = uri.find_first_of("?;");
+  size_t segments = 0;
+
+  for (size_t i = 1; i < uri.size() && i < end; ++i)
+  {
+    if (uri[i] == '/' && ++segments == 2)
+    {
+      end = i;
+      break;
+    }
+  }
+
+  return method + " " + uri.substr(0, end);
+}
+
+size_t AdaptiveTimeout::getBucket(const Poco::Int64 rtt)
+{
+  if (rtt <= FIRST_BUCKET_BOUND)
+  {
+    return 0;
+  }
+
+  double bucket = std::ceil(std::log(static_cast<double>(rtt) / FIRST_BUCKET_BOUND) / std::log(BUCKET_GROWTH));
+
+  return std::min(static_cast<size_t>(bucket), NUMBER_OF_BUCKETS - 1);
+}
+
+Poco::Int64 AdaptiveTimeout::getUpperBound(const size_t bucket)
+{
+  return static_cast<Poco::Int64>(FIRST_BUCKET_BOUND * std::pow(BUCKET_GROWTH, static_cast<double>(bucket)));
+}
+
+} // end namespace rws
+} // end namespace abb
@@ -0,0 +1,157 @@
+/***********************************************************************************************************************
+ *
+ * Copyright (c) 2026, ABB Schweiz AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with
+ * or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer in the documentation
+ *      and/or other materials provided with the
+ *      distribution.
+ *    * Neither the name of ABB nor the names of its
+ *      contributors may be used to endorse or promote
+ *      products derived from this software without
+ *      specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ***********************************************************************************************************************
+ */
+
+#include <algorithm>
+#include <map>
+#include <sstream>
+
+#include "Poco/ScopedLock.h"
+
+#include "abb_librws/rws_bandwidth_limiter.h"
+
+using namespace Poco;
+
+namespace abb
+{
+namespace rws
+{
+/***********************************************************************************************************************
+ * Class definitions: BandwidthLimiter
+ */
+
+/************************************************************
+ * Primary methods
+ */
+
+BandwidthLimiter::BandwidthLimiter(const Poco::UInt64 rate, const Poco::UInt64 burst)
+:
+rate_(0),
+burst_(0),
+tokens_(0.0),
+reserved_bytes_(0)
+{
+  setLimit(rate, burst);
+}
+
+void BandwidthLimiter::setLimit(const Poco::UInt64 rate, const Poco::UInt64 burst)
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(mutex_);
+
+  // Settle the bucket at the old rate, before switching to the new one.
+  refill();
+
+  rate_ = rate;
+  burst_ = static_cast<Poco::Int64>(burst > 0 ? burst : rate / 4);
+  tokens_ = std::min(tokens_, static_cast<double>(burst_));
+}
+
+Poco::UInt64 BandwidthLimiter::getRate()
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(mutex_);
+
+  return rate_;
+}
+
+Poco::Int64 BandwidthLimiter::reserve(const size_t size)
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(mutex_);
+
+  reserved_bytes_ += size;
+
+  if (rate_ == 0)
+  {
+    return 0;
+  }
+
+  refill();
+
+  tokens_ -= static_cast<double>(size);
+
+  // The debt is paid off at the rate, i.e. the chunk may be transferred once the bucket is no longer negative.
+  return (tokens_ >= 0.0 ? 0 : static_cast<Poco::Int64>(-tokens_ * 1e6 / static_cast<double>(rate_)));
+}
+
+Poco::UInt64 BandwidthLimiter::getNumberOfReservedBytes()
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(mutex_);
+
+  return reserved_bytes_;
+}
+
+Poco::SharedPtr<BandwidthLimiter> BandwidthLimiter::getInstance(const std::string& ip_address, const Poco::UInt16 port)
+{
+  static Poco::Mutex mutex;
+  static std::map<std::string, Poco::SharedPtr<BandwidthLimiter> > instances;
+
+  std::stringstream key;
+  key << ip_address << ":" << port;
+
+  // Lock the registry's mutex. It is released when the method goes out of scope.
+  Poco::ScopedLock<Poco::Mutex> lock(mutex);
+
+  Poco::SharedPtr<BandwidthLimiter>& p_instance = instances[key.str()];
+
+  if (p_instance.isNull())
+  {
+    p_instance = new BandwidthLimiter();
+  }
+
+  return p_instance;
+}
+
+/************************************************************
+ * Auxiliary methods
+ */
+
+void BandwidthLimiter::refill()
+{
+  Poco::Timestamp now;
+
+  if (rate_ > 0)
+  {
+    double refilled = static_cast<double>(now - last_refill_) * static_cast<double>(rate_) / 1e6;
+    tokens_ = std::min(tokens_ + refilled, static_cast<double>(burst_));
+  }
+
+  last_refill_ = now;
+}
+
+} // end namespace rws
+} // end namespace abb
@@ -0,0 +1,132 @@
+/***********************************************************************************************************************
+ *
+ * Copyright (c) 2026, ABB Schweiz AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with
+ * or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer in the documentation
+ *      and/or other materials provided with the
+ *      distribution.
+ *    * Neither the name of ABB nor the names of its
+ *      contributors may be used to endorse or promote
+ *      products derived from this software without
+ *      specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ***********************************************************************************************************************
+ */
+
+#include "Poco/ScopedLock.h"
+
+#include "abb_librws/rws_cancellation_token.h"
+
+using namespace Poco;
+
+namespace abb
+{
+namespace rws
+{
+/***********************************************************************************************************************
+ * Class definitions: CancellationToken::Registration
+ */
+
+/************************************************************
+ * Primary methods
+ */
+
+CancellationToken::Registration::Registration(const Poco::SharedPtr<CancellationToken>& p_token,
+                                              const Callback& callback)
+:
+id_(0)
+{
+  Poco::SharedPtr<CancellationToken> p_registered_token(p_token);
+
+  if (!p_registered_token.isNull())
+  {
+    // Lock the token's mutex. It is released when the scope is left.
+    ScopedLock<Mutex> lock(p_registered_token->mutex_);
+
+    if (!p_registered_token->cancelled_)
+    {
+      id_ = p_registered_token->next_id_++;
+      p_registered_token->callbacks_[id_] = callback;
+      p_token_ = p_registered_token;
+    }
+  }
+}
+
+CancellationToken::Registration::~Registration()
+{
+  if (!p_token_.isNull())
+  {
+    // Lock the token's mutex. It is released when the scope is left.
+    ScopedLock<Mutex> lock(p_token_->mutex_);
+
+    p_token_->callbacks_.erase(id_);
+  }
+}
+
+
+
+
+/***********************************************************************************************************************
+ * Class definitions: CancellationToken
+ */
+
+/************************************************************
+ * Primary methods
+ */
+
+CancellationToken::CancellationToken()
+:
+cancelled_(false),
+event_(false),
+next_id_(0)
+{}
+
+void CancellationToken::cancel()
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(mutex_);
+
+  if (cancelled_)
+  {
+    return;
+  }
+
+  cancelled_ = true;
+  event_.set();
+
+  for (std::map<unsigned int, Callback>::iterator i = callbacks_.begin(); i != callbacks_.end(); ++i)
+  {
+    i->second();
+  }
+
+  callbacks_.clear();
+}
+
+bool CancellationToken::waitForCancellation(const long timeout)
+{
+  return cancelled_ || event_.tryWait(timeout);
+}
+
+} // end namespace rws
+} // end namespace abb
@@ -0,0 +1,163 @@
+/***********************************************************************************************************************
+ *
+ * Copyright (c) 2026, ABB Schweiz AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with
+ * or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer in the documentation
+ *      and/or other materials provided with the
+ *      distribution.
+ *    * Neither the name of ABB nor the names of its
+ *      contributors may be used to endorse or promote
+ *      products derived from this software without
+ *      specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ***********************************************************************************************************************
+ */
+
+#include <map>
+#include <sstream>
+
+#include "abb_librws/rws_circuit_breaker.h"
+
+namespace abb
+{
+namespace rws
+{
+/***********************************************************************************************************************
+ * Class definitions: CircuitBreaker
+ */
+
+/************************************************************
+ * Primary methods
+ */
+
+CircuitBreaker::CircuitBreaker(const Configuration& configuration)
+:
+configuration_(configuration),
+state_(CLOSED),
+consecutive_failures_(0),
+probing_(false),
+rejected_requests_(0)
+{}
+
+bool CircuitBreaker::allowRequest()
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  Poco::ScopedLock<Poco::Mutex> lock(mutex_);
+
+  if (state_ == OPEN && opened_time_.isElapsed(configuration_.open_duration))
+  {
+    state_ = HALF_OPEN;
+    probing_ = false;
+  }
+
+  bool allowed = (state_ == CLOSED || (state_ == HALF_OPEN && !probing_));
+
+  if (state_ == HALF_OPEN && allowed)
+  {
+    probing_ = true;
+  }
+
+  if (!allowed)
+  {
+    ++rejected_requests_;
+  }
+
+  return allowed;
+}
+
+void CircuitBreaker::record(const bool success)
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  Poco::ScopedLock<Poco::Mutex> lock(mutex_);
+
+  if (success)
+  {
+    consecutive_failures_ = 0;
+    state_ = CLOSED;
+  }
+  else
+  {
+    ++consecutive_failures_;
+
+    if (state_ == HALF_OPEN || consecutive_failures_ >= configuration_.failure_threshold)
+    {
+      state_ = OPEN;
+      opened_time_.update();
+    }
+  }
+
+  probing_ = false;
+}
+
+void CircuitBreaker::abandonProbe()
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  Poco::ScopedLock<Poco::Mutex> lock(mutex_);
+
+  probing_ = false;
+}
+
+CircuitBreaker::State CircuitBreaker::getState()
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  Poco::ScopedLock<Poco::Mutex> lock(mutex_);
+
+  return state_;
+}
+
+Poco::UInt64 CircuitBreaker::getNumberOfRejectedRequests()
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  Poco::ScopedLock<Poco::Mutex> lock(mutex_);
+
+  return rejected_requests_;
+}
+
+/************************************************************
+ * Auxiliary methods
+ */
+
+Poco::SharedPtr<CircuitBreaker> CircuitBreaker::getInstance(const std::string& ip_address, const Poco::UInt16 port)
+{
+  static Poco::Mutex mutex;
+  static std::map<std::string, Poco::SharedPtr<CircuitBreaker> > instances;
+
+  std::stringstream key;
+  key << ip_address << ":" << port;
+
+  // Lock the registry's mutex. It is released when the method goes out of scope.
+  Poco::ScopedLock<Poco::Mutex> lock(mutex);
+
+  Poco::SharedPtr<CircuitBreaker>& p_instance = instances[key.str()];
+
+  if (p_instance.isNull())
+  {
+    p_instance = new CircuitBreaker();
+  }
+
+  return p_instance;
+}
+
+} // end namespace rws
+} // end namespace abb
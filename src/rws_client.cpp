@@ -109,7 +109,7 @@ void RWSClient::SubscriptionResources::add(const std::string& resource_uri, cons
  * Primary methods
  */
 
-RWSClient::RWSResult RWSClient::getContollerService()
+RWSClient::RWSResult RWSClient::getContollerService(const RequestOptions& options)
 {
   std::string uri = Services::CTRL;
 
@@ -117,10 +117,12 @@ RWSClient::RWSResult RWSClient::getContollerService()
   evaluation_conditions.parse_message_into_xml = true;
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_OK);
 
-  return evaluatePOCOResult(httpGet(uri), evaluation_conditions);
+  return getCacheable(ResponseCache::CONTROLLER_SERVICE, uri, options, evaluation_conditions);
 }
 
-RWSClient::RWSResult RWSClient::getConfigurationInstances(const std::string& topic, const std::string& type)
+RWSClient::RWSResult RWSClient::getConfigurationInstances(const std::string& topic,
+                                                          const std::string& type,
+                                                          const RequestOptions& options)
 {
   std::string uri = generateConfigurationPath(topic, type) + Resources::INSTANCES;
 
@@ -128,10 +130,13 @@ RWSClient::RWSResult RWSClient::getConfigurationInstances(const std::string& top
   evaluation_conditions.parse_message_into_xml = true;
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_OK);
 
-  return evaluatePOCOResult(httpGet(uri), evaluation_conditions);
+  return getCacheable(ResponseCache::CONFIGURATION,
+                      uri,
+                      withPriority(options, RequestOptions::PRIORITY_BULK),
+                      evaluation_conditions);
 }
 
-RWSClient::RWSResult RWSClient::getIOSignals()
+RWSClient::RWSResult RWSClient::getIOSignals(const RequestOptions& options)
 {
   std::string const & uri = SystemConstants::RWS::Resources::RW_IOSYSTEM_SIGNALS;
 
@@ -139,10 +144,10 @@ RWSClient::RWSResult RWSClient::getIOSignals()
   evaluation_conditions.parse_message_into_xml = true;
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_OK);
 
-  return evaluatePOCOResult(httpGet(uri), evaluation_conditions);
+  return evaluatePOCOResult(httpGet(uri, options), evaluation_conditions);
 }
 
-RWSClient::RWSResult RWSClient::getIOSignal(const std::string& iosignal)
+RWSClient::RWSResult RWSClient::getIOSignal(const std::string& iosignal, const RequestOptions& options)
 {
   std::string uri = generateIOSignalPath(iosignal);
 
@@ -150,10 +155,26 @@ RWSClient::RWSResult RWSClient::getIOSignal(const std::string& iosignal)
   evaluation_conditions.parse_message_into_xml = true;
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_OK);
 
-  return evaluatePOCOResult(httpGet(uri), evaluation_conditions);
+  return evaluatePOCOResult(httpGet(uri, options), evaluation_conditions);
 }
 
-RWSClient::RWSResult RWSClient::getMechanicalUnitStaticInfo(const std::string& mechunit)
+std::vector<RWSClient::RWSResult> RWSClient::getIOSignals(const std::vector<std::string>& iosignals,
+                                                          const RequestOptions& options)
+{
+  std::vector<std::string> uris;
+  for (size_t i = 0; i < iosignals.size(); ++i)
+  {
+    uris.push_back(generateIOSignalPath(iosignals[i]));
+  }
+
+  EvaluationConditions evaluation_conditions;
+  evaluation_conditions.parse_message_into_xml = true;
+  evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_OK);
+
+  return evaluatePOCOResults(httpGet(uris, options), evaluation_conditions);
+}
+
+RWSClient::RWSResult RWSClient::getMechanicalUnitStaticInfo(const std::string& mechunit, const RequestOptions& options)
 {
   std::string uri = generateMechanicalUnitPath(mechunit) + "?resource=static";
 
@@ -161,10 +182,10 @@ RWSClient::RWSResult RWSClient::getMechanicalUnitStaticInfo(const std::string& m
   evaluation_conditions.parse_message_into_xml = true;
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_OK);
 
-  return evaluatePOCOResult(httpGet(uri), evaluation_conditions);
+  return getCacheable(ResponseCache::MECHANICAL_UNIT_STATIC_INFO, uri, options, evaluation_conditions);
 }
 
-RWSClient::RWSResult RWSClient::getMechanicalUnitDynamicInfo(const std::string& mechunit)
+RWSClient::RWSResult RWSClient::getMechanicalUnitDynamicInfo(const std::string& mechunit, const RequestOptions& options)
 {
   std::string uri = generateMechanicalUnitPath(mechunit) + "?resource=dynamic";
 
@@ -172,10 +193,10 @@ RWSClient::RWSResult RWSClient::getMechanicalUnitDynamicInfo(const std::string&
   evaluation_conditions.parse_message_into_xml = true;
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_OK);
 
-  return evaluatePOCOResult(httpGet(uri), evaluation_conditions);
+  return evaluatePOCOResult(httpGet(uri, options), evaluation_conditions);
 }
 
-RWSClient::RWSResult RWSClient::getMechanicalUnitJointTarget(const std::string& mechunit)
+RWSClient::RWSResult RWSClient::getMechanicalUnitJointTarget(const std::string& mechunit, const RequestOptions& options)
 {
   std::string uri = generateMechanicalUnitPath(mechunit) + Resources::JOINTTARGET;
 
@@ -183,13 +204,14 @@ RWSClient::RWSResult RWSClient::getMechanicalUnitJointTarget(const std::string&
   evaluation_conditions.parse_message_into_xml = true;
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_OK);
 
-  return evaluatePOCOResult(httpGet(uri), evaluation_conditions);
+  return evaluatePOCOResult(httpGet(uri, options), evaluation_conditions);
 }
 
 RWSClient::RWSResult RWSClient::getMechanicalUnitRobTarget(const std::string& mechunit,
                                                            const Coordinate& coordinate,
                                                            const std::string& tool,
-                                                           const std::string& wobj)
+                                                           const std::string& wobj,
+                                                           const RequestOptions& options)
 {
   std::string uri = generateMechanicalUnitPath(mechunit) + Resources::ROBTARGET;
 
@@ -228,10 +250,10 @@ RWSClient::RWSResult RWSClient::getMechanicalUnitRobTarget(const std::string& me
   evaluation_conditions.parse_message_into_xml = true;
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_OK);
 
-  return evaluatePOCOResult(httpGet(uri), evaluation_conditions);
+  return evaluatePOCOResult(httpGet(uri, options), evaluation_conditions);
 }
 
-RWSClient::RWSResult RWSClient::getRAPIDExecution()
+RWSClient::RWSResult RWSClient::getRAPIDExecution(const RequestOptions& options)
 {
   std::string uri = Resources::RW_RAPID_EXECUTION;
 
@@ -239,10 +261,10 @@ RWSClient::RWSResult RWSClient::getRAPIDExecution()
   evaluation_conditions.parse_message_into_xml = true;
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_OK);
 
-  return evaluatePOCOResult(httpGet(uri), evaluation_conditions);
+  return evaluatePOCOResult(httpGet(uri, options), evaluation_conditions);
 }
 
-RWSClient::RWSResult RWSClient::getRAPIDModulesInfo(const std::string& task)
+RWSClient::RWSResult RWSClient::getRAPIDModulesInfo(const std::string& task, const RequestOptions& options)
 {
   std::string uri = Resources::RW_RAPID_MODULES + "?" + Queries::TASK + task;
 
@@ -250,10 +272,10 @@ RWSClient::RWSResult RWSClient::getRAPIDModulesInfo(const std::string& task)
   evaluation_conditions.parse_message_into_xml = true;
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_OK);
 
-  return evaluatePOCOResult(httpGet(uri), evaluation_conditions);
+  return evaluatePOCOResult(httpGet(uri, options), evaluation_conditions);
 }
 
-RWSClient::RWSResult RWSClient::getRAPIDTasks()
+RWSClient::RWSResult RWSClient::getRAPIDTasks(const RequestOptions& options)
 {
   std::string uri = Resources::RW_RAPID_TASKS;
 
@@ -261,10 +283,10 @@ RWSClient::RWSResult RWSClient::getRAPIDTasks()
   evaluation_conditions.parse_message_into_xml = true;
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_OK);
 
-  return evaluatePOCOResult(httpGet(uri), evaluation_conditions);
+  return getCacheable(ResponseCache::RAPID_TASKS, uri, options, evaluation_conditions);
 }
 
-RWSClient::RWSResult RWSClient::getRobotWareSystem()
+RWSClient::RWSResult RWSClient::getRobotWareSystem(const RequestOptions& options)
 {
   std::string uri = Resources::RW_SYSTEM;
 
@@ -272,10 +294,10 @@ RWSClient::RWSResult RWSClient::getRobotWareSystem()
   evaluation_conditions.parse_message_into_xml = true;
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_OK);
 
-  return evaluatePOCOResult(httpGet(uri), evaluation_conditions);
+  return getCacheable(ResponseCache::ROBOTWARE_SYSTEM, uri, options, evaluation_conditions);
 }
 
-RWSClient::RWSResult RWSClient::getSpeedRatio()
+RWSClient::RWSResult RWSClient::getSpeedRatio(const RequestOptions& options)
 {
   std::string uri = "/rw/panel/speedratio";
 
@@ -283,10 +305,10 @@ RWSClient::RWSResult RWSClient::getSpeedRatio()
   evaluation_conditions.parse_message_into_xml = true;
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_OK);
 
-  return evaluatePOCOResult(httpGet(uri), evaluation_conditions);
+  return evaluatePOCOResult(httpGet(uri, options), evaluation_conditions);
 }
 
-RWSClient::RWSResult RWSClient::getPanelControllerState()
+RWSClient::RWSResult RWSClient::getPanelControllerState(const RequestOptions& options)
 {
   std::string uri = Resources::RW_PANEL_CTRLSTATE;
 
@@ -294,10 +316,10 @@ RWSClient::RWSResult RWSClient::getPanelControllerState()
   evaluation_conditions.parse_message_into_xml = true;
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_OK);
 
-  return evaluatePOCOResult(httpGet(uri), evaluation_conditions);
+  return evaluatePOCOResult(httpGet(uri, options), evaluation_conditions);
 }
 
-RWSClient::RWSResult RWSClient::getPanelOperationMode()
+RWSClient::RWSResult RWSClient::getPanelOperationMode(const RequestOptions& options)
 {
   std::string uri = Resources::RW_PANEL_OPMODE;
 
@@ -305,10 +327,10 @@ RWSClient::RWSResult RWSClient::getPanelOperationMode()
   evaluation_conditions.parse_message_into_xml = true;
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_OK);
 
-  return evaluatePOCOResult(httpGet(uri), evaluation_conditions);
+  return evaluatePOCOResult(httpGet(uri, options), evaluation_conditions);
 }
 
-RWSClient::RWSResult RWSClient::getRAPIDSymbolData(const RAPIDResource& resource)
+RWSClient::RWSResult RWSClient::getRAPIDSymbolData(const RAPIDResource& resource, const RequestOptions& options)
 {
   std::string uri = generateRAPIDDataPath(resource);
 
@@ -316,17 +338,35 @@ RWSClient::RWSResult RWSClient::getRAPIDSymbolData(const RAPIDResource& resource
   evaluation_conditions.parse_message_into_xml = true;
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_OK);
 
-  return evaluatePOCOResult(httpGet(uri), evaluation_conditions);
+  return evaluatePOCOResult(httpGet(uri, options), evaluation_conditions);
+}
+
+std::vector<RWSClient::RWSResult> RWSClient::getRAPIDSymbolsData(const std::vector<RAPIDResource>& resources,
+                                                                 const RequestOptions& options)
+{
+  std::vector<std::string> uris;
+  for (size_t i = 0; i < resources.size(); ++i)
+  {
+    uris.push_back(generateRAPIDDataPath(resources[i]));
+  }
+
+  EvaluationConditions evaluation_conditions;
+  evaluation_conditions.parse_message_into_xml = true;
+  evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_OK);
+
+  return evaluatePOCOResults(httpGet(uris, options), evaluation_conditions);
 }
 
-RWSClient::RWSResult RWSClient::getRAPIDSymbolData(const RAPIDResource& resource, RAPIDSymbolDataAbstract* p_data)
+RWSClient::RWSResult RWSClient::getRAPIDSymbolData(const RAPIDResource& resource,
+                                                   RAPIDSymbolDataAbstract* p_data,
+                                                   const RequestOptions& options)
 {
   RWSResult result;
   std::string data_type;
 
   if (p_data)
   {
-    RWSResult temp_result = getRAPIDSymbolProperties(resource);
+    RWSResult temp_result = getRAPIDSymbolProperties(resource, options);
 
     if (temp_result.success)
     {
@@ -334,7 +374,7 @@ RWSClient::RWSResult RWSClient::getRAPIDSymbolData(const RAPIDResource& resource
 
       if (p_data->getType().compare(data_type) == 0)
       {
-        result = getRAPIDSymbolData(resource);
+        result = getRAPIDSymbolData(resource, options);
 
         if (result.success)
         {
@@ -357,7 +397,7 @@ RWSClient::RWSResult RWSClient::getRAPIDSymbolData(const RAPIDResource& resource
   return result;
 }
 
-RWSClient::RWSResult RWSClient::getRAPIDSymbolProperties(const RAPIDResource& resource)
+RWSClient::RWSResult RWSClient::getRAPIDSymbolProperties(const RAPIDResource& resource, const RequestOptions& options)
 {
   std::string uri = generateRAPIDPropertiesPath(resource);
 
@@ -365,10 +405,12 @@ RWSClient::RWSResult RWSClient::getRAPIDSymbolProperties(const RAPIDResource& re
   evaluation_conditions.parse_message_into_xml = true;
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_OK);
 
-  return evaluatePOCOResult(httpGet(uri), evaluation_conditions);
+  return evaluatePOCOResult(httpGet(uri, options), evaluation_conditions);
 }
 
-RWSClient::RWSResult RWSClient::setIOSignal(const std::string& iosignal, const std::string& value)
+RWSClient::RWSResult RWSClient::setIOSignal(const std::string& iosignal,
+                                            const std::string& value,
+                                            const RequestOptions& options)
 {
   std::string uri = generateIOSignalPath(iosignal) + "?" + Queries::ACTION_SET;
   std::string content = Identifiers::LVALUE + "=" + value;
@@ -377,10 +419,13 @@ RWSClient::RWSResult RWSClient::setIOSignal(const std::string& iosignal, const s
   evaluation_conditions.parse_message_into_xml = false;
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_NO_CONTENT);
 
-  return evaluatePOCOResult(httpPost(uri, content), evaluation_conditions);
+  return evaluatePOCOResult(httpPost(uri, content, withPriority(options, RequestOptions::PRIORITY_CONTROL)),
+                            evaluation_conditions);
 }
 
-RWSClient::RWSResult RWSClient::setRAPIDSymbolData(const RAPIDResource& resource, const std::string& data)
+RWSClient::RWSResult RWSClient::setRAPIDSymbolData(const RAPIDResource& resource,
+                                                   const std::string& data,
+                                                   const RequestOptions& options)
 {
   std::string uri = generateRAPIDDataPath(resource) + "?" + Queries::ACTION_SET;
   std::string content = Identifiers::VALUE + "=" + data;
@@ -389,15 +434,18 @@ RWSClient::RWSResult RWSClient::setRAPIDSymbolData(const RAPIDResource& resource
   evaluation_conditions.parse_message_into_xml = false;
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_NO_CONTENT);
 
-  return evaluatePOCOResult(httpPost(uri, content), evaluation_conditions);
+  return evaluatePOCOResult(httpPost(uri, content, withPriority(options, RequestOptions::PRIORITY_CONTROL)),
+                            evaluation_conditions);
 }
 
-RWSClient::RWSResult RWSClient::setRAPIDSymbolData(const RAPIDResource& resource, const RAPIDSymbolDataAbstract& data)
+RWSClient::RWSResult RWSClient::setRAPIDSymbolData(const RAPIDResource& resource,
+                                                   const RAPIDSymbolDataAbstract& data,
+                                                   const RequestOptions& options)
 {
-  return setRAPIDSymbolData(resource, data.constructString());
+  return setRAPIDSymbolData(resource, data.constructString(), options);
 }
 
-RWSClient::RWSResult RWSClient::startRAPIDExecution()
+RWSClient::RWSResult RWSClient::startRAPIDExecution(const RequestOptions& options)
 {
   std::string uri = Resources::RW_RAPID_EXECUTION + "?" + Queries::ACTION_START;
   std::string content = "regain=continue&execmode=continue&cycle=forever&condition=none&stopatbp=disabled&alltaskbytsp=false";
@@ -406,10 +454,11 @@ RWSClient::RWSResult RWSClient::startRAPIDExecution()
   evaluation_conditions.parse_message_into_xml = false;
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_NO_CONTENT);
 
-  return evaluatePOCOResult(httpPost(uri, content), evaluation_conditions);
+  return evaluatePOCOResult(httpPost(uri, content, withPriority(options, RequestOptions::PRIORITY_CONTROL)),
+                            evaluation_conditions);
 }
 
-RWSClient::RWSResult RWSClient::stopRAPIDExecution()
+RWSClient::RWSResult RWSClient::stopRAPIDExecution(const RequestOptions& options)
 {
   std::string uri = Resources::RW_RAPID_EXECUTION + "?" + Queries::ACTION_STOP;
   std::string content = "stopmode=stop";
@@ -418,10 +467,11 @@ RWSClient::RWSResult RWSClient::stopRAPIDExecution()
   evaluation_conditions.parse_message_into_xml = false;
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_NO_CONTENT);
 
-  return evaluatePOCOResult(httpPost(uri, content), evaluation_conditions);
+  return evaluatePOCOResult(httpPost(uri, content, withPriority(options, RequestOptions::PRIORITY_CONTROL)),
+                            evaluation_conditions);
 }
 
-RWSClient::RWSResult RWSClient::resetRAPIDProgramPointer()
+RWSClient::RWSResult RWSClient::resetRAPIDProgramPointer(const RequestOptions& options)
 {
   std::string uri = Resources::RW_RAPID_EXECUTION + "?" + Queries::ACTION_RESETPP;
 
@@ -429,10 +479,11 @@ RWSClient::RWSResult RWSClient::resetRAPIDProgramPointer()
   evaluation_conditions.parse_message_into_xml = false;
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_NO_CONTENT);
 
-  return evaluatePOCOResult(httpPost(uri), evaluation_conditions);
+  return evaluatePOCOResult(httpPost(uri, "", withPriority(options, RequestOptions::PRIORITY_CONTROL)),
+                            evaluation_conditions);
 }
 
-RWSClient::RWSResult RWSClient::setMotorsOn()
+RWSClient::RWSResult RWSClient::setMotorsOn(const RequestOptions& options)
 {
   std::string uri = Resources::RW_PANEL_CTRLSTATE + "?" + Queries::ACTION_SETCTRLSTATE;
   std::string content = "ctrl-state=motoron";
@@ -441,10 +492,11 @@ RWSClient::RWSResult RWSClient::setMotorsOn()
   evaluation_conditions.parse_message_into_xml = false;
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_NO_CONTENT);
 
-  return evaluatePOCOResult(httpPost(uri, content), evaluation_conditions);
+  return evaluatePOCOResult(httpPost(uri, content, withPriority(options, RequestOptions::PRIORITY_CONTROL)),
+                            evaluation_conditions);
 }
 
-RWSClient::RWSResult RWSClient::setMotorsOff()
+RWSClient::RWSResult RWSClient::setMotorsOff(const RequestOptions& options)
 {
   std::string uri = Resources::RW_PANEL_CTRLSTATE + "?" + Queries::ACTION_SETCTRLSTATE;
   std::string content = "ctrl-state=motoroff";
@@ -453,10 +505,11 @@ RWSClient::RWSResult RWSClient::setMotorsOff()
   evaluation_conditions.parse_message_into_xml = false;
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_NO_CONTENT);
 
-  return evaluatePOCOResult(httpPost(uri, content), evaluation_conditions);
+  return evaluatePOCOResult(httpPost(uri, content, withPriority(options, RequestOptions::PRIORITY_CONTROL)),
+                            evaluation_conditions);
 }
 
-RWSClient::RWSResult RWSClient::setSpeedRatio(unsigned int ratio)
+RWSClient::RWSResult RWSClient::setSpeedRatio(unsigned int ratio, const RequestOptions& options)
 {
   if(ratio > 100) throw std::out_of_range("Speed ratio argument out of range (should be 0 <= ratio <= 100)");
 
@@ -471,48 +524,196 @@ RWSClient::RWSResult RWSClient::setSpeedRatio(unsigned int ratio)
   evaluation_conditions.parse_message_into_xml = false;
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_NO_CONTENT);
 
-  return evaluatePOCOResult(httpPost(uri, content), evaluation_conditions);
+  return evaluatePOCOResult(httpPost(uri, content, withPriority(options, RequestOptions::PRIORITY_CONTROL)),
+                            evaluation_conditions);
 }
 
-RWSClient::RWSResult RWSClient::getFile(const FileResource& resource, std::string* p_file_content)
+RWSClient::RWSResult RWSClient::getFile(const FileResource& resource,
+                                        std::string* p_file_content,
+                                        const RequestOptions& options)
 {
   RWSResult rws_result;
-  POCOClient::POCOResult poco_result;
 
   if (p_file_content)
   {
-    std::string uri = generateFilePath(resource);
-    poco_result = httpGet(uri);
+    // Stream the content directly into one string (i.e. it is not copied out of the result).
+    std::string file_content;
+    StringContentSink sink(file_content);
+    rws_result = getFile(resource, sink, options);
 
-    EvaluationConditions evaluation_conditions;
-    evaluation_conditions.parse_message_into_xml = false;
-    evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_OK);
+    if (rws_result.success)
+    {
+      p_file_content->swap(file_content);
+    }
+  }
 
+  return rws_result;
+}
+
+RWSClient::RWSResult RWSClient::getFile(const FileResource& resource, ContentSink& sink, const RequestOptions& options)
+{
+  std::string uri = generateFilePath(resource);
+
+  EvaluationConditions evaluation_conditions;
+  evaluation_conditions.parse_message_into_xml = false;
+  evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_OK);
+
+  return evaluatePOCOResult(httpGet(uri, sink, withPriority(options, RequestOptions::PRIORITY_BULK)),
+                            evaluation_conditions);
+}
+
+RWSClient::RWSResult RWSClient::getFile(const FileResource& resource,
+                                        ContentSink& sink,
+                                        ResumableDownload& download,
+                                        const RequestOptions& options)
+{
+  std::string uri = generateFilePath(resource);
+
+  EvaluationConditions evaluation_conditions;
+  evaluation_conditions.parse_message_into_xml = false;
+  evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_OK);
+  evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_PARTIAL_CONTENT);
+
+  // Count the bytes written to the sink, and only let it begin once (i.e. not once per chunk).
+  Poco::UInt64 written = 0;
+  bool begun = (download.offset > 0);
+  CallbackContentSink counting_sink([&](const char* data, const size_t size)
+  {
+    if (!begun)
+    {
+      sink.begin(download.length);
+      begun = true;
+    }
+
+    if (!sink.write(data, size))
+    {
+      return false;
+    }
+
+    written += size;
+    return true;
+  });
+
+  RWSResult rws_result;
+  unsigned int failed_attempts = 0;
+
+  while (!download.isComplete())
+  {
+    Poco::Int64 last = -1;
+    if (download.chunk_size > 0)
+    {
+      last = static_cast<Poco::Int64>(download.offset + download.chunk_size - 1);
+    }
+
+    RequestOptions chunk_options(withPriority(options, RequestOptions::PRIORITY_BULK));
+    chunk_options.setRange(download.offset, last, download.validator);
+
+    written = 0;
+    POCOResult poco_result = httpGet(uri, counting_sink, chunk_options);
+    download.offset += written;
     rws_result = evaluatePOCOResult(poco_result, evaluation_conditions);
 
+    const POCOResult::POCOInfo::HTTPInfo::ResponseInfo& response = poco_result.poco_info.http.response;
+
+    if (response.p_header && response.status >= HTTPResponse::HTTP_OK &&
+        response.status < HTTPResponse::HTTP_MULTIPLE_CHOICES)
+    {
+      if (download.validator.empty())
+      {
+        download.validator = getValidator(*response.p_header);
+      }
+
+      Poco::Int64 first = -1;
+      Poco::Int64 content_last = -1;
+      Poco::Int64 total = -1;
+      if (parseContentRange(response.p_header->get(CONTENT_RANGE, ""), first, content_last, total) && total >= 0)
+      {
+        download.length = total;
+      }
+    }
+
     if (rws_result.success)
     {
-      *p_file_content = poco_result.poco_info.http.response.content;
+      // A complete (HTTP 200) response, or a short last chunk (of unknown total length), ends the file.
+      if (response.status == HTTPResponse::HTTP_OK ||
+          (download.length < 0 && (last < 0 || written < download.chunk_size)))
+      {
+        download.length = static_cast<Poco::Int64>(download.offset);
+      }
+
+      // A successful response without progress (e.g. an empty HTTP 206) counts as a failed attempt, since the same
+      // range would otherwise be requested again and again.
+      failed_attempts = (written > 0 || download.isComplete() ? 0 : failed_attempts + 1);
+
+      if (failed_attempts > 0 &&
+          (failed_attempts >= download.max_attempts || options.isExpired() || options.isCancelled()))
+      {
+        rws_result.success = false;
+        rws_result.error_message = "getFile(...): The responses did not make any progress";
+        break;
+      }
+    }
+    else if (response.status == HTTPResponse::HTTP_REQUESTED_RANGE_NOT_SATISFIABLE && response.p_header)
+    {
+      // The offset is at (or beyond) the file's end, e.g. for an empty file.
+      Poco::Int64 first = -1;
+      Poco::Int64 content_last = -1;
+      Poco::Int64 total = -1;
+      if (!parseContentRange(response.p_header->get(CONTENT_RANGE, ""), first, content_last, total) ||
+          total != static_cast<Poco::Int64>(download.offset))
+      {
+        break;
+      }
+
+      download.length = total;
+      rws_result = RWSResult();
+      rws_result.success = true;
+    }
+    else
+    {
+      // Only transport failures (e.g. a dropped connection) are resumed. Progress resets the attempt count.
+      bool transport_failure = (poco_result.status == POCOResult::EXCEPTION_POCO_TIMEOUT ||
+                                poco_result.status == POCOResult::EXCEPTION_POCO_NET);
+
+      failed_attempts = (written > 0 ? 0 : failed_attempts + 1);
+
+      if (!transport_failure || failed_attempts >= download.max_attempts || options.isExpired() ||
+          options.isCancelled())
+      {
+        break;
+      }
     }
   }
 
   return rws_result;
 }
 
-RWSClient::RWSResult RWSClient::uploadFile(const FileResource& resource, const std::string& file_content)
+RWSClient::RWSResult RWSClient::uploadFile(const FileResource& resource,
+                                           const std::string& file_content,
+                                           const RequestOptions& options)
+{
+  // Stream the content directly from the caller's string (i.e. it is neither copied nor retained in the result).
+  MemoryContentSource source(file_content);
+
+  return uploadFile(resource, source, options);
+}
+
+RWSClient::RWSResult RWSClient::uploadFile(const FileResource& resource,
+                                           ContentSource& source,
+                                           const RequestOptions& options)
 {
   std::string uri = generateFilePath(resource);
-  std::string content = file_content;
 
   EvaluationConditions evaluation_conditions;
   evaluation_conditions.parse_message_into_xml = false;
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_OK);
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_CREATED);
 
-  return evaluatePOCOResult(httpPut(uri, content), evaluation_conditions);
+  return evaluatePOCOResult(httpPut(uri, source, withPriority(options, RequestOptions::PRIORITY_BULK)),
+                            evaluation_conditions);
 }
 
-RWSClient::RWSResult RWSClient::deleteFile(const FileResource& resource)
+RWSClient::RWSResult RWSClient::deleteFile(const FileResource& resource, const RequestOptions& options)
 {
   std::string uri = generateFilePath(resource);
 
@@ -521,10 +722,22 @@ RWSClient::RWSResult RWSClient::deleteFile(const FileResource& resource)
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_OK);
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_NO_CONTENT);
 
-  return evaluatePOCOResult(httpDelete(uri), evaluation_conditions);
+  return evaluatePOCOResult(httpDelete(uri, options), evaluation_conditions);
 }
 
-RWSClient::RWSResult RWSClient::startSubscription(const SubscriptionResources& resources)
+RWSClient::RWSResult RWSClient::getDirectoryListing(const std::string& directory, const RequestOptions& options)
+{
+  std::string uri = Services::FILESERVICE + "/" + directory;
+
+  EvaluationConditions evaluation_conditions;
+  evaluation_conditions.parse_message_into_xml = true;
+  evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_OK);
+
+  return evaluatePOCOResult(httpGet(uri, withPriority(options, RequestOptions::PRIORITY_BULK)),
+                            evaluation_conditions);
+}
+
+RWSClient::RWSResult RWSClient::startSubscription(const SubscriptionResources& resources, const RequestOptions& options)
 {
   RWSResult result;
 
@@ -548,13 +761,13 @@ RWSClient::RWSResult RWSClient::startSubscription(const SubscriptionResources& r
     EvaluationConditions evaluation_conditions;
     evaluation_conditions.parse_message_into_xml = false;
     evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_CREATED);
-    POCOClient::POCOResult poco_result = httpPost(Services::SUBSCRIPTION, subscription_content.str());
+    POCOClient::POCOResult poco_result = httpPost(Services::SUBSCRIPTION, subscription_content.str(), options);
     result = evaluatePOCOResult(poco_result, evaluation_conditions);
 
     if (result.success)
     {
       std::string poll = "/poll/";
-      subscription_group_id_ = findSubstringContent(poco_result.poco_info.http.response.header_info, poll, "\n");
+      subscription_group_id_ = findSubstringContent(poco_result.poco_info.http.response.getHeaderInfo(), poll, "\n");
       poll += subscription_group_id_;
 
       // Create a WebSocket for receiving subscription events.
@@ -566,6 +779,8 @@ RWSClient::RWSResult RWSClient::startSubscription(const SubscriptionResources& r
 
       if (!result.success)
       {
+        // Remove the subscription group (best effort), since it cannot be ended without the WebSocket.
+        httpDelete(Services::SUBSCRIPTION + "/" + subscription_group_id_, options);
         subscription_group_id_.clear();
       }
     }
@@ -583,7 +798,7 @@ RWSClient::RWSResult RWSClient::waitForSubscriptionEvent()
   return evaluatePOCOResult(webSocketReceiveFrame(), evaluation_conditions);
 }
 
-RWSClient::RWSResult RWSClient::endSubscription()
+RWSClient::RWSResult RWSClient::endSubscription(const RequestOptions& options)
 {
   RWSResult result;
 
@@ -597,7 +812,7 @@ RWSClient::RWSResult RWSClient::endSubscription()
       evaluation_conditions.parse_message_into_xml = false;
       evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_OK);
 
-      result = evaluatePOCOResult(httpDelete(uri), evaluation_conditions);
+      result = evaluatePOCOResult(httpDelete(uri, options), evaluation_conditions);
     }
   }
 
@@ -609,7 +824,7 @@ void RWSClient::forceCloseSubscription()
   webSocketShutdown();
 }
 
-RWSClient::RWSResult RWSClient::logout()
+RWSClient::RWSResult RWSClient::logout(const RequestOptions& options)
 {
   std::string uri = Resources::LOGOUT;
 
@@ -617,12 +832,21 @@ RWSClient::RWSResult RWSClient::logout()
   evaluation_conditions.parse_message_into_xml = true;
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_OK);
 
-  return evaluatePOCOResult(httpGet(uri), evaluation_conditions);
+  RWSResult result = evaluatePOCOResult(httpGet(uri, options), evaluation_conditions);
+
+  // The session is no longer valid, so do not let anyone reuse it.
+  if (result.success)
+  {
+    discardSession();
+  }
+
+  return result;
 }
 
 RWSClient::RWSResult RWSClient::registerLocalUser(const std::string& username,
                                                   const std::string& application,
-                                                  const std::string& location)
+                                                  const std::string& location,
+                                                  const RequestOptions& options)
 {
   std::string uri = Services::USERS;
   std::string content = "username=" + username +
@@ -635,14 +859,15 @@ RWSClient::RWSResult RWSClient::registerLocalUser(const std::string& username,
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_OK);
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_CREATED);
 
-  RWSResult result = evaluatePOCOResult(httpPost(uri, content), evaluation_conditions);
+  RWSResult result = evaluatePOCOResult(httpPost(uri, content, options), evaluation_conditions);
 
   return result;
 }
 
 RWSClient::RWSResult RWSClient::registerRemoteUser(const std::string& username,
                                                    const std::string& application,
-                                                   const std::string& location)
+                                                   const std::string& location,
+                                                   const RequestOptions& options)
 {
   std::string uri = Services::USERS;
   std::string content = "username=" + username +
@@ -655,15 +880,376 @@ RWSClient::RWSResult RWSClient::registerRemoteUser(const std::string& username,
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_OK);
   evaluation_conditions.accepted_outcomes.push_back(HTTPResponse::HTTP_CREATED);
 
-  RWSResult result = evaluatePOCOResult(httpPost(uri, content), evaluation_conditions);
+  RWSResult result = evaluatePOCOResult(httpPost(uri, content, options), evaluation_conditions);
 
   return result;
 }
 
+/************************************************************
+ * Asynchronous methods
+ */
+
+std::future<RWSClient::RWSResult> RWSClient::runAsync(const Operation& operation, const CompletionHandler& handler)
+{
+  Poco::SharedPtr<std::promise<RWSResult> > p_promise(new std::promise<RWSResult>());
+  std::future<RWSResult> future = p_promise->get_future();
+
+  getExecutor()->submit([operation, handler, p_promise]() mutable
+                        {
+                          RWSResult result;
+                          std::exception_ptr p_exception;
+
+                          try
+                          {
+                            result = operation();
+                          }
+                          catch (const std::exception& e)
+                          {
+                            result.error_message = std::string("runAsync(...): ") + e.what();
+                            p_exception = std::current_exception();
+                          }
+                          catch (...)
+                          {
+                            result.error_message = "runAsync(...): Unknown exception";
+                            p_exception = std::current_exception();
+                          }
+
+                          if (handler)
+                          {
+                            try
+                            {
+                              handler(result);
+                            }
+                            catch (...)
+                            {
+                              // The handler's errors must not prevent the future from being fulfilled.
+                            }
+                          }
+
+                          // Hand over the result last, so this thread holds no references to it afterwards.
+                          if (p_exception)
+                          {
+                            p_promise->set_exception(p_exception);
+                          }
+                          else
+                          {
+                            p_promise->set_value(std::move(result));
+                          }
+                        });
+
+  return future;
+}
+
+void RWSClient::setAsyncThreadPoolSize(const size_t size)
+{
+  Poco::SharedPtr<Executor> p_old_executor;
+
+  {
+    Poco::ScopedLock<Poco::Mutex> lock(executor_mutex_);
+
+    async_thread_pool_size_ = size;
+
+    if (!p_executor_.isNull())
+    {
+      p_old_executor = p_executor_;
+      p_executor_ = new Executor(async_thread_pool_size_);
+    }
+  }
+
+  // The old executor completes its queued operations when it is destroyed (i.e. when going out of scope).
+}
+
+std::future<RWSClient::RWSResult> RWSClient::getContollerServiceAsync(const RequestOptions& options,
+                                                                      const CompletionHandler& handler)
+{
+  return runAsync([this, options]() { return getContollerService(options); }, handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::getConfigurationInstancesAsync(const std::string& topic,
+                                                                            const std::string& type,
+                                                                            const RequestOptions& options,
+                                                                            const CompletionHandler& handler)
+{
+  return runAsync([this, topic, type, options]() { return getConfigurationInstances(topic, type, options); }, handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::getIOSignalsAsync(const RequestOptions& options,
+                                                               const CompletionHandler& handler)
+{
+  return runAsync([this, options]() { return getIOSignals(options); }, handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::getIOSignalAsync(const std::string& iosignal,
+                                                              const RequestOptions& options,
+                                                              const CompletionHandler& handler)
+{
+  return runAsync([this, iosignal, options]() { return getIOSignal(iosignal, options); }, handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::getMechanicalUnitStaticInfoAsync(const std::string& mechunit,
+                                                                              const RequestOptions& options,
+                                                                              const CompletionHandler& handler)
+{
+  return runAsync([this, mechunit, options]() { return getMechanicalUnitStaticInfo(mechunit, options); }, handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::getMechanicalUnitDynamicInfoAsync(const std::string& mechunit,
+                                                                               const RequestOptions& options,
+                                                                               const CompletionHandler& handler)
+{
+  return runAsync([this, mechunit, options]() { return getMechanicalUnitDynamicInfo(mechunit, options); }, handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::getMechanicalUnitJointTargetAsync(const std::string& mechunit,
+                                                                               const RequestOptions& options,
+                                                                               const CompletionHandler& handler)
+{
+  return runAsync([this, mechunit, options]() { return getMechanicalUnitJointTarget(mechunit, options); }, handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::getMechanicalUnitRobTargetAsync(const std::string& mechunit,
+                                                                             const Coordinate& coordinate,
+                                                                             const std::string& tool,
+                                                                             const std::string& wobj,
+                                                                             const RequestOptions& options,
+                                                                             const CompletionHandler& handler)
+{
+  return runAsync([this, mechunit, coordinate, tool, wobj, options]()
+                  {
+                    return getMechanicalUnitRobTarget(mechunit, coordinate, tool, wobj, options);
+                  },
+                  handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::getRAPIDSymbolDataAsync(const RAPIDResource& resource,
+                                                                     const RequestOptions& options,
+                                                                     const CompletionHandler& handler)
+{
+  return runAsync([this, resource, options]() { return getRAPIDSymbolData(resource, options); }, handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::getRAPIDSymbolDataAsync(const RAPIDResource& resource,
+                                                                     RAPIDSymbolDataAbstract* p_data,
+                                                                     const RequestOptions& options,
+                                                                     const CompletionHandler& handler)
+{
+  return runAsync([this, resource, p_data, options]()
+                  {
+                    return getRAPIDSymbolData(resource, p_data, options);
+                  },
+                  handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::getRAPIDSymbolPropertiesAsync(const RAPIDResource& resource,
+                                                                           const RequestOptions& options,
+                                                                           const CompletionHandler& handler)
+{
+  return runAsync([this, resource, options]() { return getRAPIDSymbolProperties(resource, options); }, handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::getRAPIDExecutionAsync(const RequestOptions& options,
+                                                                    const CompletionHandler& handler)
+{
+  return runAsync([this, options]() { return getRAPIDExecution(options); }, handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::getRAPIDModulesInfoAsync(const std::string& task,
+                                                                      const RequestOptions& options,
+                                                                      const CompletionHandler& handler)
+{
+  return runAsync([this, task, options]() { return getRAPIDModulesInfo(task, options); }, handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::getRAPIDTasksAsync(const RequestOptions& options,
+                                                                const CompletionHandler& handler)
+{
+  return runAsync([this, options]() { return getRAPIDTasks(options); }, handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::getRobotWareSystemAsync(const RequestOptions& options,
+                                                                     const CompletionHandler& handler)
+{
+  return runAsync([this, options]() { return getRobotWareSystem(options); }, handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::getSpeedRatioAsync(const RequestOptions& options,
+                                                                const CompletionHandler& handler)
+{
+  return runAsync([this, options]() { return getSpeedRatio(options); }, handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::getPanelControllerStateAsync(const RequestOptions& options,
+                                                                          const CompletionHandler& handler)
+{
+  return runAsync([this, options]() { return getPanelControllerState(options); }, handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::getPanelOperationModeAsync(const RequestOptions& options,
+                                                                        const CompletionHandler& handler)
+{
+  return runAsync([this, options]() { return getPanelOperationMode(options); }, handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::setIOSignalAsync(const std::string& iosignal,
+                                                              const std::string& value,
+                                                              const RequestOptions& options,
+                                                              const CompletionHandler& handler)
+{
+  return runAsync([this, iosignal, value, options]() { return setIOSignal(iosignal, value, options); }, handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::setRAPIDSymbolDataAsync(const RAPIDResource& resource,
+                                                                     const std::string& data,
+                                                                     const RequestOptions& options,
+                                                                     const CompletionHandler& handler)
+{
+  return runAsync([this, resource, data, options]() { return setRAPIDSymbolData(resource, data, options); }, handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::setRAPIDSymbolDataAsync(const RAPIDResource& resource,
+                                                                     const RAPIDSymbolDataAbstract& data,
+                                                                     const RequestOptions& options,
+                                                                     const CompletionHandler& handler)
+{
+  // The data is converted up front, since the caller is free to destroy it once this method has returned.
+  return setRAPIDSymbolDataAsync(resource, data.constructString(), options, handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::startRAPIDExecutionAsync(const RequestOptions& options,
+                                                                      const CompletionHandler& handler)
+{
+  return runAsync([this, options]() { return startRAPIDExecution(options); }, handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::stopRAPIDExecutionAsync(const RequestOptions& options,
+                                                                     const CompletionHandler& handler)
+{
+  return runAsync([this, options]() { return stopRAPIDExecution(options); }, handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::resetRAPIDProgramPointerAsync(const RequestOptions& options,
+                                                                           const CompletionHandler& handler)
+{
+  return runAsync([this, options]() { return resetRAPIDProgramPointer(options); }, handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::setMotorsOnAsync(const RequestOptions& options,
+                                                              const CompletionHandler& handler)
+{
+  return runAsync([this, options]() { return setMotorsOn(options); }, handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::setMotorsOffAsync(const RequestOptions& options,
+                                                               const CompletionHandler& handler)
+{
+  return runAsync([this, options]() { return setMotorsOff(options); }, handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::setSpeedRatioAsync(unsigned int ratio,
+                                                                const RequestOptions& options,
+                                                                const CompletionHandler& handler)
+{
+  return runAsync([this, ratio, options]() { return setSpeedRatio(ratio, options); }, handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::getFileAsync(const FileResource& resource,
+                                                          std::string* p_file_content,
+                                                          const RequestOptions& options,
+                                                          const CompletionHandler& handler)
+{
+  return runAsync([this, resource, p_file_content, options]()
+                  {
+                    return getFile(resource, p_file_content, options);
+                  },
+                  handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::uploadFileAsync(const FileResource& resource,
+                                                             const std::string& file_content,
+                                                             const RequestOptions& options,
+                                                             const CompletionHandler& handler)
+{
+  return runAsync([this, resource, file_content, options]()
+                  {
+                    return uploadFile(resource, file_content, options);
+                  },
+                  handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::deleteFileAsync(const FileResource& resource,
+                                                             const RequestOptions& options,
+                                                             const CompletionHandler& handler)
+{
+  return runAsync([this, resource, options]() { return deleteFile(resource, options); }, handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::startSubscriptionAsync(const SubscriptionResources& resources,
+                                                                    const RequestOptions& options,
+                                                                    const CompletionHandler& handler)
+{
+  return runAsync([this, resources, options]() { return startSubscription(resources, options); }, handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::waitForSubscriptionEventAsync(const CompletionHandler& handler)
+{
+  return runAsync([this]() { return waitForSubscriptionEvent(); }, handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::endSubscriptionAsync(const RequestOptions& options,
+                                                                  const CompletionHandler& handler)
+{
+  return runAsync([this, options]() { return endSubscription(options); }, handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::logoutAsync(const RequestOptions& options,
+                                                         const CompletionHandler& handler)
+{
+  return runAsync([this, options]() { return logout(options); }, handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::registerLocalUserAsync(const std::string& username,
+                                                                    const std::string& application,
+                                                                    const std::string& location,
+                                                                    const RequestOptions& options,
+                                                                    const CompletionHandler& handler)
+{
+  return runAsync([this, username, application, location, options]()
+                  {
+                    return registerLocalUser(username, application, location, options);
+                  },
+                  handler);
+}
+
+std::future<RWSClient::RWSResult> RWSClient::registerRemoteUserAsync(const std::string& username,
+                                                                     const std::string& application,
+                                                                     const std::string& location,
+                                                                     const RequestOptions& options,
+                                                                     const CompletionHandler& handler)
+{
+  return runAsync([this, username, application, location, options]()
+                  {
+                    return registerRemoteUser(username, application, location, options);
+                  },
+                  handler);
+}
+
 /************************************************************
  * Auxiliary methods
  */
 
+Poco::SharedPtr<Executor> RWSClient::getExecutor()
+{
+  // Lock the executor's mutex. It is released when the method goes out of scope.
+  Poco::ScopedLock<Poco::Mutex> lock(executor_mutex_);
+
+  if (p_executor_.isNull())
+  {
+    p_executor_ = new Executor(async_thread_pool_size_);
+  }
+
+  return p_executor_;
+}
+
 RWSClient::RWSResult RWSClient::evaluatePOCOResult(const POCOResult& poco_result,
                                                    const EvaluationConditions& conditions)
 {
@@ -676,11 +1262,44 @@ RWSClient::RWSResult RWSClient::evaluatePOCOResult(const POCOResult& poco_result
     parseMessage(&result, poco_result);
   }
 
-  if (log_.size() >= LOG_SIZE)
+  flight_recorder_.record(poco_result);
+
+  return result;
+}
+
+std::vector<RWSClient::RWSResult> RWSClient::evaluatePOCOResults(const std::vector<POCOResult>& poco_results,
+                                                                 const EvaluationConditions& conditions)
+{
+  std::vector<RWSResult> results;
+  results.reserve(poco_results.size());
+
+  for (size_t i = 0; i < poco_results.size(); ++i)
   {
-    log_.pop_back();
+    results.push_back(evaluatePOCOResult(poco_results[i], conditions));
+  }
+
+  return results;
+}
+
+RWSClient::RWSResult RWSClient::getCacheable(const ResponseCache::ResourceClass resource_class,
+                                             const std::string& uri,
+                                             const RequestOptions& options,
+                                             const EvaluationConditions& conditions)
+{
+  RWSResult result;
+
+  if (response_cache_.lookup(resource_class, uri, result.p_xml_document))
+  {
+    result.success = true;
+    return result;
+  }
+
+  result = evaluatePOCOResult(httpGet(uri, options), conditions);
+
+  if (result.success)
+  {
+    response_cache_.store(resource_class, uri, result.p_xml_document);
   }
-  log_.push_front(poco_result);
 
   return result;
 }
@@ -710,17 +1329,15 @@ void RWSClient::parseMessage(RWSResult* result, const POCOResult& poco_result)
 {
   if (result)
   {
-    std::stringstream ss;
+    // Parse directly from the shared response buffer (i.e. without copying it into a stream first).
+    const std::string* p_message = &poco_result.poco_info.http.response.getContent();
 
-    if (!poco_result.poco_info.http.response.content.empty())
-    {
-      ss << poco_result.poco_info.http.response.content;
-    }
-    else if (!poco_result.poco_info.websocket.frame_content.empty())
+    if (p_message->empty())
     {
-      ss << poco_result.poco_info.websocket.frame_content;
+      p_message = &poco_result.poco_info.websocket.getFrameContent();
     }
-    else
+
+    if (p_message->empty())
     {
       // XML parsing: Missing message
       result->success = false;
@@ -731,8 +1348,7 @@ void RWSClient::parseMessage(RWSResult* result, const POCOResult& poco_result)
     {
       try
       {
-        Poco::XML::InputSource input_source(ss);
-        result->p_xml_document = Poco::XML::DOMParser().parse(&input_source);
+        result->p_xml_document = Poco::XML::DOMParser().parseMemory(p_message->data(), p_message->size());
       }
       catch (...)
       {
@@ -746,18 +1362,20 @@ void RWSClient::parseMessage(RWSResult* result, const POCOResult& poco_result)
 
 std::string RWSClient::getLogText(const bool verbose)
 {
-  if (log_.size() == 0)
+  std::vector<FlightRecorder::Record> records = flight_recorder_.getRecords();
+
+  if (records.size() == 0)
   {
     return "";
   }
 
   std::stringstream ss;
 
-  for (size_t i = 0; i < log_.size(); ++i)
+  for (size_t i = 0; i < records.size(); ++i)
   {
     std::stringstream temp;
     temp << i + 1 << ". ";
-    ss << temp.str() << log_[i].toString(verbose, temp.str().size()) << std::endl;
+    ss << temp.str() << records[i].toString(verbose, temp.str().size()) << std::endl;
   }
 
   return ss.str();
@@ -765,7 +1383,9 @@ std::string RWSClient::getLogText(const bool verbose)
 
 std::string RWSClient::getLogTextLatestEvent(const bool verbose)
 {
-  return (log_.size() == 0 ? "" : log_[0].toString(verbose, 0));
+  std::vector<FlightRecorder::Record> records = flight_recorder_.getRecords(1);
+
+  return (records.size() == 0 ? "" : records[0].toString(verbose, 0));
 }
 
 std::string RWSClient::generateConfigurationPath(const std::string& topic, const std::string& type)
@@ -798,5 +1418,18 @@ std::string RWSClient::generateFilePath(const FileResource& resource)
   return Services::FILESERVICE + "/" + resource.directory + "/" + resource.filename;
 }
 
+RWSClient::RequestOptions RWSClient::withPriority(const RequestOptions& options,
+                                                  const RequestOptions::Priority priority)
+{
+  RequestOptions prioritized_options(options);
+
+  if (!prioritized_options.hasPriority())
+  {
+    prioritized_options.setPriority(priority);
+  }
+
+  return prioritized_options;
+}
+
 } // end namespace rws
 } // end namespace abb
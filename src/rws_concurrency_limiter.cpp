@@ -0,0 +1,236 @@
+/***********************************************************************************************************************
+ *
+ * Copyright (c) 2026, ABB Schweiz AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with
+ * or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer in the documentation
+ *      and/or other materials provided with the
+ *      distribution.
+ *    * Neither the name of ABB nor the names of its
+ *      contributors may be used to endorse or promote
+ *      products derived from this software without
+ *      specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ***********************************************************************************************************************
+ */
+
+#include <algorithm>
+#include <map>
+#include <sstream>
+
+#include "Poco/ScopedLock.h"
+
+#include "abb_librws/rws_concurrency_limiter.h"
+
+using namespace Poco;
+
+namespace abb
+{
+namespace rws
+{
+/***********************************************************************************************************************
+ * Class definitions: ConcurrencyLimiter
+ */
+
+const double ConcurrencyLimiter::SMOOTHING_FACTOR = 0.2;
+const double ConcurrencyLimiter::BASELINE_DRIFT_FACTOR = 0.01;
+
+/************************************************************
+ * Primary methods
+ */
+
+ConcurrencyLimiter::ConcurrencyLimiter(const Configuration& configuration)
+:
+configuration_(configuration),
+limit_(std::min(std::max(configuration.initial_limit, configuration.min_limit), configuration.max_limit)),
+active_requests_(0),
+decreases_(0)
+{
+  last_decrease_ -= configuration.decrease_interval;
+}
+
+bool ConcurrencyLimiter::acquire(const Poco::Int64 timeout,
+                                 const Poco::SharedPtr<CancellationToken>& p_cancellation_token)
+{
+  // Wake the waiting requests if the request is cancelled (registered before the limiter's mutex is locked, since
+  // the callback locks it while the token's mutex is held).
+  CancellationToken::Registration registration(p_cancellation_token, [this]()
+  {
+    ScopedLock<Mutex> lock(mutex_);
+    condition_.broadcast();
+  });
+
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(mutex_);
+
+  Poco::Timestamp start_time;
+
+  // At least one request is always admitted, regardless of the limit.
+  while (active_requests_ > 0 && static_cast<double>(active_requests_ + 1) > limit_)
+  {
+    if (!p_cancellation_token.isNull() && p_cancellation_token->isCancelled())
+    {
+      return false;
+    }
+
+    if (timeout < 0)
+    {
+      condition_.wait(mutex_);
+    }
+    else
+    {
+      Poco::Int64 remaining_time = timeout - start_time.elapsed();
+
+      if (remaining_time <= 0)
+      {
+        return false;
+      }
+
+      // Round up, so that the wait does not end just before the timeout.
+      condition_.tryWait(mutex_, static_cast<long>((remaining_time + 999) / 1000));
+    }
+  }
+
+  if (!p_cancellation_token.isNull() && p_cancellation_token->isCancelled())
+  {
+    return false;
+  }
+
+  ++active_requests_;
+
+  return true;
+}
+
+void ConcurrencyLimiter::release(const Outcome outcome, const std::string& endpoint_class, const Poco::Int64 latency)
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(mutex_);
+
+  // Grow only while (at least half of) the limit is used, since an unused limit says nothing about the capacity.
+  bool limited = (static_cast<double>(active_requests_) * 2.0 >= limit_);
+
+  if (active_requests_ > 0)
+  {
+    --active_requests_;
+  }
+
+  bool overload = (outcome == OVERLOAD);
+
+  if (outcome == SUCCESS && latency >= 0 && configuration_.latency_tolerance > 0.0)
+  {
+    overload = isLatencyOverloaded(endpoint_class, latency);
+  }
+
+  if (overload)
+  {
+    if (last_decrease_.elapsed() >= configuration_.decrease_interval)
+    {
+      limit_ = std::max(limit_ * configuration_.decrease_factor, configuration_.min_limit);
+      last_decrease_.update();
+      ++decreases_;
+    }
+  }
+  else if (outcome == SUCCESS && limited)
+  {
+    limit_ = std::min(limit_ + 1.0 / limit_, configuration_.max_limit);
+  }
+
+  condition_.broadcast();
+}
+
+double ConcurrencyLimiter::getLimit()
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(mutex_);
+
+  return limit_;
+}
+
+size_t ConcurrencyLimiter::getNumberOfActiveRequests()
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(mutex_);
+
+  return active_requests_;
+}
+
+Poco::UInt64 ConcurrencyLimiter::getNumberOfDecreases()
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(mutex_);
+
+  return decreases_;
+}
+
+Poco::SharedPtr<ConcurrencyLimiter> ConcurrencyLimiter::getInstance(const std::string& ip_address,
+                                                                    const Poco::UInt16 port)
+{
+  static Poco::Mutex mutex;
+  static std::map<std::string, Poco::SharedPtr<ConcurrencyLimiter> > instances;
+
+  std::stringstream key;
+  key << ip_address << ":" << port;
+
+  // Lock the registry's mutex. It is released when the method goes out of scope.
+  Poco::ScopedLock<Poco::Mutex> lock(mutex);
+
+  Poco::SharedPtr<ConcurrencyLimiter>& p_instance = instances[key.str()];
+
+  if (p_instance.isNull())
+  {
+    p_instance = new ConcurrencyLimiter();
+  }
+
+  return p_instance;
+}
+
+/************************************************************
+ * Auxiliary methods
+ */
+
+bool ConcurrencyLimiter::isLatencyOverloaded(const std::string& endpoint_class, const Poco::Int64 latency)
+{
+  LatencyStatistics& statistics = latencies_[endpoint_class];
+  double sample = static_cast<double>(latency);
+
+  if (statistics.samples == 0)
+  {
+    statistics.baseline = sample;
+    statistics.smoothed = sample;
+  }
+  else
+  {
+    // The baseline follows decreases immediately, and increases slowly (e.g. after a change of the workload).
+    statistics.baseline = (sample < statistics.baseline ?
+                           sample : statistics.baseline + (sample - statistics.baseline) * BASELINE_DRIFT_FACTOR);
+    statistics.smoothed += (sample - statistics.smoothed) * SMOOTHING_FACTOR;
+  }
+
+  ++statistics.samples;
+
+  return (statistics.samples >= configuration_.min_samples &&
+          statistics.smoothed > statistics.baseline * configuration_.latency_tolerance);
+}
+
+} // end namespace rws
+} // end namespace abb
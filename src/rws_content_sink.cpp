@@ -0,0 +1,133 @@
+/***********************************************************************************************************************
+ *
+ * Copyright (c) 2026, ABB Schweiz AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with
+ * or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer in the documentation
+ *      and/or other materials provided with the
+ *      distribution.
+ *    * Neither the name of ABB nor the names of its
+ *      contributors may be used to endorse or promote
+ *      products derived from this software without
+ *      specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ***********************************************************************************************************************
+ */
+
+#include <cerrno>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#elif defined(_WIN32)
+#include <io.h>
+#endif
+
+#include "abb_librws/rws_content_sink.h"
+
+namespace abb
+{
+namespace rws
+{
+/***********************************************************************************************************************
+ * Class definitions: StreamContentSink
+ */
+
+/************************************************************
+ * Primary methods
+ */
+
+bool StreamContentSink::write(const char* data, const size_t size)
+{
+  stream_.write(data, static_cast<std::streamsize>(size));
+
+  return stream_.good();
+}
+
+
+
+
+/***********************************************************************************************************************
+ * Class definitions: StringContentSink
+ */
+
+/************************************************************
+ * Primary methods
+ */
+
+void StringContentSink::begin(const Poco::Int64 content_length)
+{
+  if (content_length > 0)
+  {
+    content_.reserve(content_.size() + static_cast<size_t>(content_length));
+  }
+}
+
+bool StringContentSink::write(const char* data, const size_t size)
+{
+  content_.append(data, size);
+
+  return true;
+}
+
+
+
+
+/***********************************************************************************************************************
+ * Class definitions: FileDescriptorContentSink
+ */
+
+/************************************************************
+ * Primary methods
+ */
+
+bool FileDescriptorContentSink::write(const char* data, const size_t size)
+{
+  size_t written = 0;
+
+  // The data may be written partially (e.g. to a pipe), so keep writing until all of it has been written.
+  while (written < size)
+  {
+#if defined(_WIN32)
+    int result = ::_write(file_descriptor_, data + written, static_cast<unsigned int>(size - written));
+#else
+    ssize_t result = ::write(file_descriptor_, data + written, size - written);
+#endif
+
+    if (result < 0 && errno == EINTR)
+    {
+      continue;
+    }
+
+    if (result <= 0)
+    {
+      return false;
+    }
+
+    written += static_cast<size_t>(result);
+  }
+
+  return true;
+}
+
+} // end namespace rws
+} // end namespace abb
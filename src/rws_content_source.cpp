@@ -0,0 +1,178 @@
+/***********************************************************************************************************************
+ *
+ * Copyright (c) 2026, ABB Schweiz AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with
+ * or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer in the documentation
+ *      and/or other materials provided with the
+ *      distribution.
+ *    * Neither the name of ABB nor the names of its
+ *      contributors may be used to endorse or promote
+ *      products derived from this software without
+ *      specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ***********************************************************************************************************************
+ */
+
+#include <algorithm>
+
+#include "Poco/Exception.h"
+#include "Poco/File.h"
+
+#include "abb_librws/rws_content_source.h"
+
+namespace abb
+{
+namespace rws
+{
+/***********************************************************************************************************************
+ * Class definitions: MemoryContentSource
+ */
+
+/************************************************************
+ * Primary methods
+ */
+
+bool MemoryContentSource::next(const char*& data, size_t& size)
+{
+  if (position_ >= size_)
+  {
+    return false;
+  }
+
+  data = data_ + position_;
+  size = std::min(size_ - position_, CHUNK_SIZE);
+  position_ += size;
+
+  return true;
+}
+
+
+
+
+/***********************************************************************************************************************
+ * Class definitions: MappedFileContentSource
+ */
+
+/************************************************************
+ * Primary methods
+ */
+
+MappedFileContentSource::MappedFileContentSource(const std::string& path)
+{
+  Poco::File file(path);
+
+  if (file.getSize() > 0)
+  {
+    mapping_ = Poco::SharedMemory(file, Poco::SharedMemory::AM_READ);
+    setData(mapping_.begin(), static_cast<size_t>(mapping_.end() - mapping_.begin()));
+  }
+}
+
+
+
+
+/***********************************************************************************************************************
+ * Class definitions: StreamContentSource
+ */
+
+/************************************************************
+ * Primary methods
+ */
+
+StreamContentSource::StreamContentSource(std::istream& stream, const Poco::Int64 length)
+:
+stream_(stream),
+length_(length),
+start_(-1),
+buffer_(CHUNK_SIZE)
+{
+  std::streampos start = stream_.tellg();
+
+  if (start != std::streampos(-1))
+  {
+    start_ = static_cast<std::streamoff>(start);
+
+    if (length_ < 0 && stream_.seekg(0, std::ios::end))
+    {
+      length_ = static_cast<Poco::Int64>(static_cast<std::streamoff>(stream_.tellg()) - start_);
+      stream_.seekg(start_);
+    }
+  }
+
+  stream_.clear();
+}
+
+bool StreamContentSource::next(const char*& data, size_t& size)
+{
+  if (stream_.eof())
+  {
+    return false;
+  }
+
+  stream_.read(buffer_.begin(), static_cast<std::streamsize>(buffer_.size()));
+
+  if (stream_.bad())
+  {
+    throw Poco::IOException("The content stream could not be read");
+  }
+
+  data = buffer_.begin();
+  size = static_cast<size_t>(stream_.gcount());
+
+  return size > 0;
+}
+
+bool StreamContentSource::rewind()
+{
+  if (start_ < 0)
+  {
+    return false;
+  }
+
+  stream_.clear();
+
+  return static_cast<bool>(stream_.seekg(start_));
+}
+
+
+
+
+/***********************************************************************************************************************
+ * Class definitions: CallbackContentSource
+ */
+
+/************************************************************
+ * Primary methods
+ */
+
+bool CallbackContentSource::next(const char*& data, size_t& size)
+{
+  data = buffer_.begin();
+  size = producer_(buffer_.begin(), buffer_.size());
+
+  return size > 0;
+}
+
+} // end namespace rws
+} // end namespace abb
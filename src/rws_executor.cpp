@@ -0,0 +1,135 @@
+/***********************************************************************************************************************
+ *
+ * Copyright (c) 2026, ABB Schweiz AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with
+ * or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer in the documentation
+ *      and/or other materials provided with the
+ *      distribution.
+ *    * Neither the name of ABB nor the names of its
+ *      contributors may be used to endorse or promote
+ *      products derived from this software without
+ *      specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ***********************************************************************************************************************
+ */
+
+#include "abb_librws/rws_executor.h"
+
+namespace abb
+{
+namespace rws
+{
+/***********************************************************************************************************************
+ * Class definitions: Executor
+ */
+
+/************************************************************
+ * Primary methods
+ */
+
+Executor::Executor(const size_t number_of_threads)
+:
+stopping_(false),
+runnable_(*this, &Executor::work)
+{
+  for (size_t i = 0; i < (number_of_threads > 0 ? number_of_threads : 1); ++i)
+  {
+    Poco::SharedPtr<Poco::Thread> p_thread(new Poco::Thread("rws_executor"));
+    p_thread->start(runnable_);
+    threads_.push_back(p_thread);
+  }
+}
+
+Executor::~Executor()
+{
+  {
+    Poco::ScopedLock<Poco::Mutex> lock(mutex_);
+    stopping_ = true;
+    condition_.broadcast();
+  }
+
+  for (size_t i = 0; i < threads_.size(); ++i)
+  {
+    threads_[i]->join();
+  }
+}
+
+void Executor::submit(const Task& task)
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  Poco::ScopedLock<Poco::Mutex> lock(mutex_);
+
+  tasks_.push_back(task);
+  condition_.signal();
+}
+
+size_t Executor::getNumberOfQueuedTasks()
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  Poco::ScopedLock<Poco::Mutex> lock(mutex_);
+
+  return tasks_.size();
+}
+
+/************************************************************
+ * Auxiliary methods
+ */
+
+void Executor::work()
+{
+  while (true)
+  {
+    Task task;
+
+    {
+      Poco::ScopedLock<Poco::Mutex> lock(mutex_);
+
+      while (tasks_.empty() && !stopping_)
+      {
+        condition_.wait(mutex_);
+      }
+
+      // Drain the queue before stopping, so that no queued task is silently dropped.
+      if (tasks_.empty())
+      {
+        return;
+      }
+
+      task = tasks_.front();
+      tasks_.pop_front();
+    }
+
+    try
+    {
+      task();
+    }
+    catch (...)
+    {
+      // Tasks are expected to report their own errors (e.g. via futures).
+    }
+  }
+}
+
+} // end namespace rws
+} // end namespace abb
@@ -0,0 +1,308 @@
+/***********************************************************************************************************************
+ *
+ * Copyright (c) 2026, ABB Schweiz AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with
+ * or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer in the documentation
+ *      and/or other materials provided with the
+ *      distribution.
+ *    * Neither the name of ABB nor the names of its
+ *      contributors may be used to endorse or promote
+ *      products derived from this software without
+ *      specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ***********************************************************************************************************************
+ */
+
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+
+#include "Poco/Exception.h"
+#include "Poco/File.h"
+#include "Poco/ScopedLock.h"
+
+#include "abb_librws/rws_executor.h"
+#include "abb_librws/rws_file_mirror.h"
+
+namespace abb
+{
+namespace rws
+{
+typedef SystemConstants::RWS::Identifiers   Identifiers;
+typedef SystemConstants::RWS::XMLAttributes XMLAttributes;
+
+/***********************************************************************************************************************
+ * Class definitions: FileMirror
+ */
+
+/************************************************************
+ * Primary methods
+ */
+
+FileMirror::FileMirror(RWSClient& client, const Configuration& configuration)
+:
+client_(client),
+configuration_(configuration)
+{}
+
+FileMirror::Result FileMirror::synchronize(const std::string& remote_directory,
+                                           const std::string& local_directory,
+                                           const RWSClient::RequestOptions& options)
+{
+  Result result;
+
+  try
+  {
+    Poco::File(local_directory).createDirectories();
+  }
+  catch (const Poco::Exception&)
+  {
+    result.failed_paths.push_back(".");
+    return result;
+  }
+
+  result.success = true;
+
+  const std::string manifest_path = local_directory + "/" + configuration_.manifest_filename;
+  const Manifest old_manifest = loadManifest(manifest_path);
+  Manifest new_manifest;
+
+  {
+    // The executor's destructor waits for the queued downloads, while the listing continues on this thread.
+    Executor executor(configuration_.max_concurrent_downloads);
+    std::deque<std::string> directories(1, "");
+
+    while (!directories.empty())
+    {
+      const std::string relative_directory = directories.front();
+      directories.pop_front();
+
+      const std::string remote = remote_directory + (relative_directory.empty() ? "" : "/" + relative_directory);
+      const std::string local = local_directory + (relative_directory.empty() ? "" : "/" + relative_directory);
+      const std::string prefix = (relative_directory.empty() ? "" : relative_directory + "/");
+
+      RWSClient::RWSResult listing = client_.getDirectoryListing(remote, options);
+
+      // Lock the object's mutex. It is released when the scope is left.
+      Poco::ScopedLock<Poco::Mutex> lock(mutex_);
+
+      if (!listing.success)
+      {
+        result.success = false;
+        result.failed_paths.push_back(relative_directory.empty() ? "." : relative_directory);
+
+        // Keep the manifest's entries for the unlisted directory, so that its files are not downloaded needlessly.
+        for (Manifest::const_iterator i = old_manifest.lower_bound(prefix); i != old_manifest.end(); ++i)
+        {
+          if (i->first.compare(0, prefix.size(), prefix) != 0)
+          {
+            break;
+          }
+
+          new_manifest.insert(*i);
+        }
+
+        continue;
+      }
+
+      ++result.listed_directories;
+
+      std::vector<Poco::XML::Node*> nodes = xmlFindNodes(listing.p_xml_document, XMLAttributes::CLASS_FS_DIR);
+      for (size_t i = 0; i < nodes.size(); ++i)
+      {
+        std::string name = xmlNodeGetAttributeValue(nodes.at(i), Identifiers::TITLE);
+
+        if (!name.empty() && name != "." && name != "..")
+        {
+          directories.push_back(prefix + name);
+        }
+      }
+
+      nodes = xmlFindNodes(listing.p_xml_document, XMLAttributes::CLASS_FS_FILE);
+      for (size_t i = 0; i < nodes.size(); ++i)
+      {
+        std::string name = xmlNodeGetAttributeValue(nodes.at(i), Identifiers::TITLE);
+
+        if (name.empty() || (relative_directory.empty() && name == configuration_.manifest_filename))
+        {
+          continue;
+        }
+
+        FileState state;
+        state.size = std::strtoull(xmlFindTextContent(nodes.at(i), XMLAttributes::CLASS_FS_SIZE).c_str(), 0, 10);
+        state.modified = xmlFindTextContent(nodes.at(i), XMLAttributes::CLASS_FS_MDATE);
+
+        const std::string relative_path = prefix + name;
+        const std::string local_path = local + "/" + name;
+
+        // Skip the file if it is unchanged since the last synchronization, and the local copy is still intact.
+        Manifest::const_iterator entry = old_manifest.find(relative_path);
+        if (entry != old_manifest.end() && entry->second == state)
+        {
+          Poco::File local_file(local_path);
+
+          if (local_file.exists() && local_file.getSize() == state.size)
+          {
+            new_manifest[relative_path] = state;
+            ++result.unchanged_files;
+            continue;
+          }
+        }
+
+        executor.submit([this, remote, name, local_path, relative_path, state, &options, &new_manifest, &result]()
+                        {
+                          download(remote, name, local_path, relative_path, state, options, new_manifest, result);
+                        });
+      }
+    }
+  }
+
+  if (!saveManifest(manifest_path, new_manifest))
+  {
+    result.success = false;
+    result.failed_paths.push_back(configuration_.manifest_filename);
+  }
+
+  return result;
+}
+
+/************************************************************
+ * Auxiliary methods
+ */
+
+void FileMirror::download(const std::string& remote_directory,
+                          const std::string& filename,
+                          const std::string& local_path,
+                          const std::string& relative_path,
+                          const FileState& state,
+                          const RWSClient::RequestOptions& options,
+                          Manifest& manifest,
+                          Result& result)
+{
+  const std::string temporary_path = local_path + ".part";
+  bool success = false;
+
+  try
+  {
+    Poco::File(local_path.substr(0, local_path.find_last_of('/'))).createDirectories();
+
+    {
+      std::ofstream stream(temporary_path.c_str(), std::ios::binary | std::ios::trunc);
+      StreamContentSink sink(stream);
+
+      success = stream.is_open() &&
+                client_.getFile(RWSClient::FileResource(filename, remote_directory), sink, options).success;
+
+      stream.close();
+      success = success && !stream.fail();
+    }
+
+    if (success)
+    {
+      Poco::File(temporary_path).renameTo(local_path);
+    }
+    else
+    {
+      Poco::File(temporary_path).remove();
+    }
+  }
+  catch (const Poco::Exception&)
+  {
+    success = false;
+  }
+
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  Poco::ScopedLock<Poco::Mutex> lock(mutex_);
+
+  if (success)
+  {
+    manifest[relative_path] = state;
+    ++result.downloaded_files;
+    result.downloaded_bytes += state.size;
+  }
+  else
+  {
+    result.success = false;
+    result.failed_paths.push_back(relative_path);
+  }
+}
+
+FileMirror::Manifest FileMirror::loadManifest(const std::string& path)
+{
+  Manifest manifest;
+  std::ifstream stream(path.c_str());
+  std::string line;
+
+  // Each line holds a file's size, modification date and relative path, separated by tabs.
+  while (std::getline(stream, line))
+  {
+    size_t first_tab = line.find('\t');
+    size_t second_tab = (first_tab == std::string::npos ? first_tab : line.find('\t', first_tab + 1));
+
+    if (second_tab != std::string::npos)
+    {
+      FileState state;
+      state.size = std::strtoull(line.substr(0, first_tab).c_str(), 0, 10);
+      state.modified = line.substr(first_tab + 1, second_tab - first_tab - 1);
+      manifest[line.substr(second_tab + 1)] = state;
+    }
+  }
+
+  return manifest;
+}
+
+bool FileMirror::saveManifest(const std::string& path, const Manifest& manifest)
+{
+  const std::string temporary_path = path + ".part";
+
+  try
+  {
+    {
+      std::ofstream stream(temporary_path.c_str(), std::ios::trunc);
+
+      for (Manifest::const_iterator i = manifest.begin(); i != manifest.end(); ++i)
+      {
+        stream << i->second.size << '\t' << i->second.modified << '\t' << i->first << '\n';
+      }
+
+      stream.close();
+
+      if (stream.fail())
+      {
+        return false;
+      }
+    }
+
+    Poco::File(temporary_path).renameTo(path);
+  }
+  catch (const Poco::Exception&)
+  {
+    return false;
+  }
+
+  return true;
+}
+
+} // end namespace rws
+} // end namespace abb
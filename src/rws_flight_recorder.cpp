@@ -0,0 +1,212 @@
+/***********************************************************************************************************************
+ *
+ * Copyright (c) 2026, ABB Schweiz AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with
+ * or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer in the documentation
+ *      and/or other materials provided with the
+ *      distribution.
+ *    * Neither the name of ABB nor the names of its
+ *      contributors may be used to endorse or promote
+ *      products derived from this software without
+ *      specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ***********************************************************************************************************************
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+
+#include "Poco/Timestamp.h"
+
+#include "abb_librws/rws_flight_recorder.h"
+
+namespace
+{
+/**
+ * \brief A function for copying a (possibly truncated) text string into a fixed-size, zero-terminated, buffer.
+ *
+ * \param destination for the destination buffer.
+ * \param size for the destination buffer's size.
+ * \param source for the text string to copy.
+ */
+void copyTruncated(char* destination, const size_t size, const std::string& source)
+{
+  size_t length = std::min(source.size(), size - 1);
+  std::memcpy(destination, source.data(), length);
+  destination[length] = '\0';
+}
+}
+
+namespace abb
+{
+namespace rws
+{
+/***********************************************************************************************************************
+ * Struct definitions: FlightRecorder::Record
+ */
+
+/************************************************************
+ * Auxiliary methods
+ */
+
+POCOClient::POCOResult FlightRecorder::Record::toPOCOResult() const
+{
+  POCOClient::POCOResult result;
+
+  result.status = status;
+  result.exception_message = exception_message;
+  result.duration = duration;
+  result.poco_info.http.request.method = method;
+  result.poco_info.http.request.uri = uri;
+  result.poco_info.http.response.status = http_status;
+  result.poco_info.websocket.flags = websocket_flags;
+
+  if (content_length > 0)
+  {
+    Poco::SharedPtr<const std::string> p_content(new std::string(content, content_length));
+
+    if (result.poco_info.http.request.method.empty())
+    {
+      result.poco_info.websocket.p_frame_content = p_content;
+    }
+    else
+    {
+      result.poco_info.http.response.p_content = p_content;
+    }
+  }
+
+  return result;
+}
+
+std::string FlightRecorder::Record::toString(const bool verbose, const size_t indent) const
+{
+  std::stringstream ss;
+
+  std::string seperator = (indent == 0 ? " | " : "\n" + std::string(indent, ' '));
+
+  ss << toPOCOResult().toString(verbose, indent);
+
+  ss << seperator << "Duration: " << duration << " us"
+     << seperator << "Bytes (sent/received): " << request_bytes << "/" << response_bytes;
+
+  if (verbose && content_length < response_bytes && content_length > 0)
+  {
+    ss << seperator << "(Content truncated to " << content_length << " bytes)";
+  }
+
+  return ss.str();
+}
+
+/***********************************************************************************************************************
+ * Class definitions: FlightRecorder
+ */
+
+/************************************************************
+ * Primary methods
+ */
+
+FlightRecorder::FlightRecorder(const size_t capacity)
+:
+slots_(capacity > 0 ? capacity : 1),
+next_ticket_(0),
+dropped_records_(0),
+verbosity_(SUMMARY)
+{}
+
+void FlightRecorder::record(const POCOClient::POCOResult& poco_result)
+{
+  const Poco::UInt64 ticket = next_ticket_.fetch_add(1);
+  Slot& slot = slots_[ticket % slots_.size()];
+
+  // Claim the slot, unless another writer is busy with it, or has already written a newer record into it.
+  Poco::UInt64 sequence = slot.sequence.load(std::memory_order_acquire);
+
+  if ((sequence & 1) || sequence > 2 * ticket ||
+      !slot.sequence.compare_exchange_strong(sequence, 2 * ticket + 1, std::memory_order_acq_rel))
+  {
+    ++dropped_records_;
+    return;
+  }
+
+  Record& record = slot.record;
+  const std::string& content = (poco_result.poco_info.http.request.method.empty() ?
+                                poco_result.poco_info.websocket.getFrameContent() :
+                                poco_result.poco_info.http.response.getContent());
+
+  record.timestamp = Poco::Timestamp().epochMicroseconds();
+  record.duration = poco_result.duration;
+  record.status = poco_result.status;
+  record.http_status = poco_result.poco_info.http.response.status;
+  record.websocket_flags = poco_result.poco_info.websocket.flags;
+  record.request_bytes = poco_result.poco_info.http.request.content.size();
+  record.response_bytes = content.size();
+  copyTruncated(record.method, Record::MAX_METHOD_LENGTH, poco_result.poco_info.http.request.method);
+  copyTruncated(record.uri, Record::MAX_URI_LENGTH, poco_result.poco_info.http.request.uri);
+  copyTruncated(record.exception_message, Record::MAX_EXCEPTION_LENGTH, poco_result.exception_message);
+
+  if (verbosity_ == CONTENT)
+  {
+    record.content_length = std::min(content.size(), Record::MAX_CONTENT_LENGTH);
+    std::memcpy(record.content, content.data(), record.content_length);
+  }
+  else
+  {
+    record.content_length = 0;
+  }
+
+  // Publish the record.
+  slot.sequence.store(2 * ticket + 2, std::memory_order_release);
+}
+
+std::vector<FlightRecorder::Record> FlightRecorder::getRecords(const size_t max_records) const
+{
+  std::vector<Record> records;
+
+  const Poco::UInt64 end = next_ticket_.load(std::memory_order_acquire);
+  const Poco::UInt64 count = std::min<Poco::UInt64>(end, std::min(max_records, slots_.size()));
+
+  for (Poco::UInt64 ticket = end; ticket > end - count; --ticket)
+  {
+    const Slot& slot = slots_[(ticket - 1) % slots_.size()];
+    const Poco::UInt64 expected = 2 * ticket;
+
+    // Copy the record, and then verify that it was not written over (or still being written) in the meantime.
+    if (slot.sequence.load(std::memory_order_acquire) == expected)
+    {
+      Record record = slot.record;
+      std::atomic_thread_fence(std::memory_order_acquire);
+
+      if (slot.sequence.load(std::memory_order_relaxed) == expected)
+      {
+        records.push_back(record);
+      }
+    }
+  }
+
+  return records;
+}
+
+} // end namespace rws
+} // end namespace abb
@@ -569,11 +569,11 @@ std::vector<RWSInterface::RobotWareOptionInfo> RWSInterface::getPresentRobotWare
   return result;
 }
 
-std::string RWSInterface::getIOSignal(const std::string& iosignal)
+std::string RWSInterface::getIOSignal(const std::string& iosignal, const RWSClient::RequestOptions& options)
 {
   std::string result;
 
-  RWSClient::RWSResult rws_result = rws_client_.getIOSignal(iosignal);
+  RWSClient::RWSResult rws_result = rws_client_.getIOSignal(iosignal, options);
 
   if (rws_result.success)
   {
@@ -929,30 +929,32 @@ RWSInterface::SystemInfo RWSInterface::getSystemInfo()
   return result;
 }
 
-TriBool RWSInterface::isAutoMode()
+TriBool RWSInterface::isAutoMode(const RWSClient::RequestOptions& options)
 {
-  return compareSingleContent(rws_client_.getPanelOperationMode(),
+  return compareSingleContent(rws_client_.getPanelOperationMode(options),
                               XMLAttributes::CLASS_OPMODE,
                               ContollerStates::PANEL_OPERATION_MODE_AUTO);
 }
 
-TriBool RWSInterface::isMotorsOn()
+TriBool RWSInterface::isMotorsOn(const RWSClient::RequestOptions& options)
 {
-  return compareSingleContent(rws_client_.getPanelControllerState(),
+  return compareSingleContent(rws_client_.getPanelControllerState(options),
                               XMLAttributes::CLASS_CTRLSTATE,
                               ContollerStates::CONTROLLER_MOTOR_ON);
 }
 
-TriBool RWSInterface::isRAPIDRunning()
+TriBool RWSInterface::isRAPIDRunning(const RWSClient::RequestOptions& options)
 {
-  return compareSingleContent(rws_client_.getRAPIDExecution(),
+  return compareSingleContent(rws_client_.getRAPIDExecution(options),
                               XMLAttributes::CLASS_CTRLEXECSTATE,
                               ContollerStates::RAPID_EXECUTION_RUNNING);
 }
 
-bool RWSInterface::setIOSignal(const std::string& iosignal, const std::string& value)
+bool RWSInterface::setIOSignal(const std::string& iosignal,
+                               const std::string& value,
+                               const RWSClient::RequestOptions& options)
 {
-  return rws_client_.setIOSignal(iosignal, value).success;
+  return rws_client_.setIOSignal(iosignal, value, options).success;
 }
 
 std::string RWSInterface::getRAPIDSymbolData(const std::string& task,
@@ -983,11 +985,21 @@ bool RWSInterface::getFile(const RWSClient::FileResource& resource, std::string*
   return rws_client_.getFile(resource, p_file_content).success;
 }
 
+bool RWSInterface::getFile(const RWSClient::FileResource& resource, ContentSink& sink)
+{
+  return rws_client_.getFile(resource, sink).success;
+}
+
 bool RWSInterface::uploadFile(const RWSClient::FileResource& resource, const std::string& file_content)
 {
   return rws_client_.uploadFile(resource, file_content).success;
 }
 
+bool RWSInterface::uploadFile(const RWSClient::FileResource& resource, ContentSource& source)
+{
+  return rws_client_.uploadFile(resource, source).success;
+}
+
 bool RWSInterface::deleteFile(const RWSClient::FileResource& resource)
 {
   return rws_client_.deleteFile(resource).success;
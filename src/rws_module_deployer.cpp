@@ -0,0 +1,453 @@
+/***********************************************************************************************************************
+ *
+ * Copyright (c) 2026, ABB Schweiz AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with
+ * or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer in the documentation
+ *      and/or other materials provided with the
+ *      distribution.
+ *    * Neither the name of ABB nor the names of its
+ *      contributors may be used to endorse or promote
+ *      products derived from this software without
+ *      specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ***********************************************************************************************************************
+ */
+
+#include <algorithm>
+#include <fstream>
+
+#include "Poco/Exception.h"
+#include "Poco/File.h"
+#include "Poco/ScopedLock.h"
+#include "Poco/SHA1Engine.h"
+#include "Poco/Thread.h"
+#include "Poco/Timestamp.h"
+
+#include "abb_librws/rws_executor.h"
+#include "abb_librws/rws_module_deployer.h"
+
+namespace abb
+{
+namespace rws
+{
+typedef RWSStateMachineInterface::ResourceIdentifiers::RAPID::Procedures Procedures;
+
+/***********************************************************************************************************************
+ * Class definitions: ModuleDeployer
+ */
+
+const std::string ModuleDeployer::SIDECAR_EXTENSION = ".sha1";
+
+/************************************************************
+ * Primary methods
+ */
+
+ModuleDeployer::ModuleDeployer(RWSStateMachineInterface& rws_interface, const Configuration& configuration)
+:
+rws_interface_(rws_interface),
+configuration_(configuration)
+{}
+
+ModuleDeployer::Result ModuleDeployer::deploy(const std::vector<Module>& modules)
+{
+  Result result;
+  Manifest manifest;
+
+  if (!configuration_.manifest_path.empty())
+  {
+    manifest = loadManifest(configuration_.manifest_path);
+  }
+
+  std::vector<Deployment> deployments;
+  deployments.reserve(modules.size());
+  std::set<std::string> tasks;
+
+  for (size_t i = 0; i < modules.size(); ++i)
+  {
+    Deployment deployment(&modules[i]);
+    deployment.name = modules[i].filename.substr(0, modules[i].filename.find_last_of('.'));
+    deployment.path = modules[i].directory + "/" + modules[i].filename;
+    deployment.hash = computeHash(modules[i].content);
+    deployments.push_back(deployment);
+    tasks.insert(modules[i].task);
+  }
+
+  // Find out which modules are loaded, and which hashes have been recorded (with the requests made in parallel).
+  std::map<std::string, std::set<std::string> > loaded_modules;
+  std::vector<std::function<void()> > jobs;
+
+  for (std::set<std::string>::const_iterator i = tasks.begin(); i != tasks.end(); ++i)
+  {
+    const std::string task = *i;
+    jobs.push_back([this, task, &loaded_modules]()
+                   {
+                     std::set<std::string> names = getLoadedModules(task);
+                     Poco::ScopedLock<Poco::Mutex> lock(mutex_);
+                     loaded_modules[task].swap(names);
+                   });
+  }
+
+  for (size_t i = 0; i < deployments.size(); ++i)
+  {
+    Manifest::const_iterator entry = manifest.find(deployments[i].p_module->task + ":" + deployments[i].path);
+
+    if (entry != manifest.end() && entry->second == deployments[i].hash)
+    {
+      deployments[i].recorded = true;
+    }
+    else if (configuration_.use_sidecar_files)
+    {
+      Deployment* p_deployment = &deployments[i];
+      jobs.push_back([this, p_deployment]()
+                     {
+                       std::string hash;
+                       RWSClient::FileResource sidecar(p_deployment->p_module->filename + SIDECAR_EXTENSION,
+                                                       p_deployment->p_module->directory);
+
+                       if (rws_interface_.getFile(sidecar, &hash) && hash == p_deployment->hash)
+                       {
+                         Poco::ScopedLock<Poco::Mutex> lock(mutex_);
+                         p_deployment->recorded = true;
+                       }
+                     });
+    }
+  }
+
+  runInParallel(jobs);
+
+  std::vector<Deployment*> changed;
+
+  for (size_t i = 0; i < deployments.size(); ++i)
+  {
+    deployments[i].loaded = (loaded_modules[deployments[i].p_module->task].count(deployments[i].name) > 0);
+
+    if (deployments[i].recorded && deployments[i].loaded)
+    {
+      manifest[deployments[i].p_module->task + ":" + deployments[i].path] = deployments[i].hash;
+      ++result.skipped_modules;
+    }
+    else
+    {
+      changed.push_back(&deployments[i]);
+    }
+  }
+
+  // Upload the changed (or unloaded) modules, since the recorded files could have been removed meanwhile.
+  jobs.clear();
+  for (size_t i = 0; i < changed.size(); ++i)
+  {
+    Deployment* p_deployment = changed[i];
+    jobs.push_back([this, p_deployment]()
+                   {
+                     RWSClient::FileResource resource(p_deployment->p_module->filename,
+                                                      p_deployment->p_module->directory);
+
+                     if (!rws_interface_.uploadFile(resource, p_deployment->p_module->content))
+                     {
+                       Poco::ScopedLock<Poco::Mutex> lock(mutex_);
+                       p_deployment->failed = true;
+                     }
+                   });
+  }
+
+  runInParallel(jobs);
+
+  // (Re)load the uploaded modules, in rounds of one module per task (all tasks are signaled at once).
+  std::map<std::string, std::vector<Deployment*> > per_task;
+  size_t rounds = 0;
+
+  for (size_t i = 0; i < changed.size(); ++i)
+  {
+    if (!changed[i]->failed)
+    {
+      std::vector<Deployment*>& task_deployments = per_task[changed[i]->p_module->task];
+      task_deployments.push_back(changed[i]);
+      rounds = std::max(rounds, task_deployments.size());
+    }
+  }
+
+  for (size_t round = 0; round < rounds; ++round)
+  {
+    std::vector<Deployment*> unloads;
+    std::vector<Deployment*> loads;
+
+    for (std::map<std::string, std::vector<Deployment*> >::const_iterator i = per_task.begin();
+         i != per_task.end();
+         ++i)
+    {
+      if (round < i->second.size())
+      {
+        if (i->second[round]->loaded)
+        {
+          unloads.push_back(i->second[round]);
+        }
+
+        loads.push_back(i->second[round]);
+      }
+    }
+
+    runModuleProcedure(unloads, Procedures::RUN_MODULE_UNLOAD, false);
+    runModuleProcedure(loads, Procedures::RUN_MODULE_LOAD, true);
+  }
+
+  // Record the hashes of the deployed modules.
+  jobs.clear();
+  for (size_t i = 0; i < changed.size(); ++i)
+  {
+    const std::string key = changed[i]->p_module->task + ":" + changed[i]->path;
+
+    if (changed[i]->failed)
+    {
+      result.failed_modules.push_back(changed[i]->p_module->task + ":" + changed[i]->p_module->filename);
+      manifest.erase(key);
+      continue;
+    }
+
+    manifest[key] = changed[i]->hash;
+    ++result.deployed_modules;
+
+    if (configuration_.use_sidecar_files && !changed[i]->recorded)
+    {
+      const Deployment* p_deployment = changed[i];
+      jobs.push_back([this, p_deployment]()
+                     {
+                       // A missing sidecar file only causes the module to be deployed again next time.
+                       rws_interface_.uploadFile(RWSClient::FileResource(p_deployment->p_module->filename +
+                                                                         SIDECAR_EXTENSION,
+                                                                         p_deployment->p_module->directory),
+                                                 p_deployment->hash);
+                     });
+    }
+  }
+
+  runInParallel(jobs);
+
+  if (!configuration_.manifest_path.empty() && !saveManifest(configuration_.manifest_path, manifest))
+  {
+    return result;
+  }
+
+  result.success = result.failed_modules.empty();
+
+  return result;
+}
+
+std::string ModuleDeployer::computeHash(const std::string& content)
+{
+  Poco::SHA1Engine engine;
+  engine.update(content);
+
+  return Poco::DigestEngine::digestToHex(engine.digest());
+}
+
+/************************************************************
+ * Auxiliary methods
+ */
+
+void ModuleDeployer::runInParallel(const std::vector<std::function<void()> >& tasks)
+{
+  if (tasks.size() == 1)
+  {
+    tasks.front()();
+    return;
+  }
+
+  if (!tasks.empty())
+  {
+    // The executor's destructor waits for all of the tasks to complete.
+    Executor executor(std::min(tasks.size(), configuration_.max_concurrent_requests));
+
+    for (size_t i = 0; i < tasks.size(); ++i)
+    {
+      executor.submit(tasks[i]);
+    }
+  }
+}
+
+void ModuleDeployer::runModuleProcedure(const std::vector<Deployment*>& round,
+                                        const std::string& procedure,
+                                        const bool loaded)
+{
+  std::vector<std::function<void()> > jobs;
+
+  // Set the inputs of all tasks' procedures.
+  for (size_t i = 0; i < round.size(); ++i)
+  {
+    Deployment* p_deployment = round[i];
+    jobs.push_back([this, p_deployment, &procedure]()
+                   {
+                     const std::string& task = p_deployment->p_module->task;
+
+                     if (!rws_interface_.services().rapid().setModuleFilePath(task, p_deployment->path) ||
+                         !rws_interface_.services().rapid().setRoutineName(task, procedure))
+                     {
+                       Poco::ScopedLock<Poco::Mutex> lock(mutex_);
+                       p_deployment->failed = true;
+                     }
+                   });
+  }
+
+  runInParallel(jobs);
+
+  std::vector<Deployment*> pending;
+  for (size_t i = 0; i < round.size(); ++i)
+  {
+    if (!round[i]->failed)
+    {
+      pending.push_back(round[i]);
+    }
+  }
+
+  // Run the procedures of all tasks with one signal.
+  if (pending.empty())
+  {
+    return;
+  }
+
+  if (!rws_interface_.services().rapid().signalRunRAPIDRoutine())
+  {
+    for (size_t i = 0; i < pending.size(); ++i)
+    {
+      pending[i]->failed = true;
+    }
+
+    return;
+  }
+
+  // Wait for the modules to be (un)loaded.
+  Poco::Timestamp start_time;
+
+  while (true)
+  {
+    jobs.clear();
+    for (size_t i = 0; i < pending.size(); ++i)
+    {
+      Deployment* p_deployment = pending[i];
+      jobs.push_back([this, p_deployment, loaded]()
+                     {
+                       bool is_loaded = (getLoadedModules(p_deployment->p_module->task).count(p_deployment->name) > 0);
+                       Poco::ScopedLock<Poco::Mutex> lock(mutex_);
+                       p_deployment->loaded = is_loaded;
+                     });
+    }
+
+    runInParallel(jobs);
+
+    std::vector<Deployment*> remaining;
+    for (size_t i = 0; i < pending.size(); ++i)
+    {
+      if (pending[i]->loaded != loaded)
+      {
+        remaining.push_back(pending[i]);
+      }
+    }
+
+    pending.swap(remaining);
+
+    if (pending.empty())
+    {
+      break;
+    }
+
+    if (start_time.isElapsed(configuration_.load_timeout))
+    {
+      for (size_t i = 0; i < pending.size(); ++i)
+      {
+        pending[i]->failed = true;
+      }
+
+      break;
+    }
+
+    Poco::Thread::sleep(static_cast<long>(configuration_.poll_interval / 1000));
+  }
+}
+
+std::set<std::string> ModuleDeployer::getLoadedModules(const std::string& task)
+{
+  std::set<std::string> names;
+  std::vector<RWSInterface::RAPIDModuleInfo> modules = rws_interface_.getRAPIDModulesInfo(task);
+
+  for (size_t i = 0; i < modules.size(); ++i)
+  {
+    names.insert(modules[i].name);
+  }
+
+  return names;
+}
+
+ModuleDeployer::Manifest ModuleDeployer::loadManifest(const std::string& path)
+{
+  Manifest manifest;
+  std::ifstream stream(path.c_str());
+  std::string line;
+
+  // Each line holds a module's hash, and its task and path (as "<task>:<path>"), separated by a tab.
+  while (std::getline(stream, line))
+  {
+    size_t tab = line.find('\t');
+
+    if (tab != std::string::npos)
+    {
+      manifest[line.substr(tab + 1)] = line.substr(0, tab);
+    }
+  }
+
+  return manifest;
+}
+
+bool ModuleDeployer::saveManifest(const std::string& path, const Manifest& manifest)
+{
+  const std::string temporary_path = path + ".part";
+
+  try
+  {
+    {
+      std::ofstream stream(temporary_path.c_str(), std::ios::trunc);
+
+      for (Manifest::const_iterator i = manifest.begin(); i != manifest.end(); ++i)
+      {
+        stream << i->second << '\t' << i->first << '\n';
+      }
+
+      stream.close();
+
+      if (stream.fail())
+      {
+        return false;
+      }
+    }
+
+    Poco::File(temporary_path).renameTo(path);
+  }
+  catch (const Poco::Exception&)
+  {
+    return false;
+  }
+
+  return true;
+}
+
+} // end namespace rws
+} // end namespace abb
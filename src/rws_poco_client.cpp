@@ -34,11 +34,15 @@
  ***********************************************************************************************************************
  */
 
+#include <algorithm>
+#include <cstdlib>
 #include <sstream>
 
 #include "Poco/Net/HTTPRequest.h"
 #include "Poco/Net/NetException.h"
 #include "Poco/StreamCopier.h"
+#include "Poco/Thread.h"
+#include "Poco/Timestamp.h"
 
 #include "abb_librws/rws_poco_client.h"
 
@@ -49,6 +53,221 @@ namespace abb
 {
 namespace rws
 {
+namespace
+{
+/**
+ * \brief A callback for pacing a streamed transfer, which is called with each chunk's size before it is transferred.
+ *
+ * The callback may pause the transfer, e.g. to yield to more urgent requests, or to limit the bandwidth.
+ */
+typedef std::function<void(const size_t size)> PacingHandler;
+
+/**
+ * \brief A class for counting the bytes written to a content sink, and for reporting the progress.
+ */
+class ProgressSink : public ContentSink
+{
+public:
+  /**
+   * \brief A constructor.
+   *
+   * \param sink for the sink to forward the content to.
+   * \param progress_handler for an optional callback for reporting the progress.
+   * \param pacing_handler for an optional callback for pacing the transfer.
+   */
+  ProgressSink(ContentSink& sink,
+               const POCOClient::RequestOptions::ProgressHandler& progress_handler,
+               const PacingHandler& pacing_handler = PacingHandler())
+  :
+  sink_(sink),
+  progress_handler_(progress_handler),
+  pacing_handler_(pacing_handler),
+  transferred_(0),
+  total_(-1)
+  {}
+
+  /**
+   * \brief A method called before the first chunk is written (see ContentSink::begin(...)).
+   *
+   * \param content_length for the content's length [bytes] (negative if unknown).
+   */
+  void begin(const Poco::Int64 content_length)
+  {
+    total_ = content_length;
+    sink_.begin(content_length);
+  }
+
+  /**
+   * \brief A method for writing a chunk of the content (see ContentSink::write(...)).
+   *
+   * \param data for the chunk's data.
+   * \param size for the chunk's size [bytes].
+   *
+   * \return bool indicating if the transfer should continue.
+   */
+  bool write(const char* data, const size_t size)
+  {
+    if (pacing_handler_)
+    {
+      pacing_handler_(size);
+    }
+
+    if (!sink_.write(data, size))
+    {
+      return false;
+    }
+
+    transferred_ += size;
+
+    if (progress_handler_)
+    {
+      progress_handler_(transferred_, total_);
+    }
+
+    return true;
+  }
+
+  /**
+   * \brief A method for retrieving the number of bytes written to the sink.
+   *
+   * \return Poco::UInt64 containing the number of bytes.
+   */
+  Poco::UInt64 getTransferred() const { return transferred_; }
+
+private:
+  /**
+   * \brief The sink to forward the content to.
+   */
+  ContentSink& sink_;
+
+  /**
+   * \brief Callback for reporting the progress.
+   */
+  const POCOClient::RequestOptions::ProgressHandler& progress_handler_;
+
+  /**
+   * \brief Callback for pacing the transfer.
+   */
+  PacingHandler pacing_handler_;
+
+  /**
+   * \brief The number of bytes written to the sink.
+   */
+  Poco::UInt64 transferred_;
+
+  /**
+   * \brief The content's length [bytes] (negative if unknown).
+   */
+  Poco::Int64 total_;
+};
+
+/**
+ * \brief A class for counting the bytes read from a content source, and for reporting the progress.
+ */
+class ProgressSource : public ContentSource
+{
+public:
+  /**
+   * \brief A constructor.
+   *
+   * \param source for the source to read the content from.
+   * \param progress_handler for an optional callback for reporting the progress.
+   * \param pacing_handler for an optional callback for pacing the transfer.
+   */
+  ProgressSource(ContentSource& source,
+                 const POCOClient::RequestOptions::ProgressHandler& progress_handler,
+                 const PacingHandler& pacing_handler = PacingHandler())
+  :
+  source_(source),
+  progress_handler_(progress_handler),
+  pacing_handler_(pacing_handler),
+  transferred_(0)
+  {}
+
+  /**
+   * \brief A method for retrieving the content's length (see ContentSource::getLength()).
+   *
+   * \return Poco::Int64 containing the content's length [bytes] (negative if unknown).
+   */
+  Poco::Int64 getLength() const { return source_.getLength(); }
+
+  /**
+   * \brief A method for retrieving the next chunk of the content (see ContentSource::next(...)).
+   *
+   * \param data for pointing to the chunk's data.
+   * \param size for the chunk's size [bytes].
+   *
+   * \return bool indicating if a chunk was retrieved.
+   */
+  bool next(const char*& data, size_t& size)
+  {
+    if (!source_.next(data, size))
+    {
+      return false;
+    }
+
+    // The chunk is sent after it has been retrieved, i.e. it can be paced before it leaves.
+    if (pacing_handler_)
+    {
+      pacing_handler_(size);
+    }
+
+    transferred_ += size;
+
+    if (progress_handler_)
+    {
+      progress_handler_(transferred_, source_.getLength());
+    }
+
+    return true;
+  }
+
+  /**
+   * \brief A method for restarting the content from the beginning (see ContentSource::rewind()).
+   *
+   * \return bool indicating if the content was restarted.
+   */
+  bool rewind()
+  {
+    // Nothing needs to be restarted before the first chunk has been read.
+    if (transferred_ == 0)
+    {
+      return true;
+    }
+
+    if (!source_.rewind())
+    {
+      return false;
+    }
+
+    transferred_ = 0;
+
+    return true;
+  }
+
+private:
+  /**
+   * \brief The source to read the content from.
+   */
+  ContentSource& source_;
+
+  /**
+   * \brief Callback for reporting the progress.
+   */
+  const POCOClient::RequestOptions::ProgressHandler& progress_handler_;
+
+  /**
+   * \brief Callback for pacing the transfer.
+   */
+  PacingHandler pacing_handler_;
+
+  /**
+   * \brief The number of bytes read from the source.
+   */
+  Poco::UInt64 transferred_;
+};
+}
+
 /***********************************************************************************************************************
  * Struct definitions: POCOClient::POCOResult
  */
@@ -66,31 +285,53 @@ void POCOClient::POCOResult::addHTTPRequestInfo(const Poco::Net::HTTPRequest& re
 }
 
 void POCOClient::POCOResult::addHTTPResponseInfo(const Poco::Net::HTTPResponse& response,
-                                                 const std::string& response_content)
+                                                 const Poco::SharedPtr<const std::string>& p_response_content)
 {
-  std::string header_info;
-
-  for (HTTPResponse::ConstIterator i = response.begin(); i != response.end(); ++i)
-  {
-    header_info += i->first + "=" + i->second + "\n";
-  }
-
   poco_info.http.response.status = response.getStatus();
-  poco_info.http.response.header_info = header_info;
-  poco_info.http.response.content = response_content;
+  poco_info.http.response.p_header = new NameValueCollection(response);
+  poco_info.http.response.p_content = p_response_content;
 }
 
 void POCOClient::POCOResult::addWebSocketFrameInfo(const int flags,
-                                                   const std::string& frame_content)
+                                                   const Poco::SharedPtr<const std::string>& p_frame_content)
 {
   poco_info.websocket.flags = flags;
-  poco_info.websocket.frame_content = frame_content;
+  poco_info.websocket.p_frame_content = p_frame_content;
 }
 
 /************************************************************
  * Auxiliary methods
  */
 
+std::string POCOClient::POCOResult::POCOInfo::HTTPInfo::ResponseInfo::getHeaderInfo() const
+{
+  std::string header_info;
+
+  if (!p_header.isNull())
+  {
+    for (NameValueCollection::ConstIterator i = p_header->begin(); i != p_header->end(); ++i)
+    {
+      header_info += i->first + "=" + i->second + "\n";
+    }
+  }
+
+  return header_info;
+}
+
+const std::string& POCOClient::POCOResult::POCOInfo::HTTPInfo::ResponseInfo::getContent() const
+{
+  static const std::string empty;
+
+  return (p_content.isNull() ? empty : *p_content);
+}
+
+const std::string& POCOClient::POCOResult::POCOInfo::WebSocketInfo::getFrameContent() const
+{
+  static const std::string empty;
+
+  return (p_frame_content.isNull() ? empty : *p_frame_content);
+}
+
 std::string POCOClient::POCOResult::mapGeneralStatus() const
 {
   std::string result;
@@ -125,6 +366,18 @@ std::string POCOClient::POCOResult::mapGeneralStatus() const
       result = "EXCEPTION_POCO_WEBSOCKET";
     break;
 
+    case POCOResult::CIRCUIT_OPEN:
+      result = "CIRCUIT_OPEN";
+    break;
+
+    case POCOResult::TRANSFER_ABORTED:
+      result = "TRANSFER_ABORTED";
+    break;
+
+    case POCOResult::CANCELLED:
+      result = "CANCELLED";
+    break;
+
     default:
       result = "UNDEFINED";
     break;
@@ -190,7 +443,7 @@ std::string POCOClient::POCOResult::toString(const bool verbose, const size_t in
 
       if (verbose)
       {
-        ss << seperator << "HTTP Response Content: " << poco_info.http.response.content;
+        ss << seperator << "HTTP Response Content: " << poco_info.http.response.getContent();
       }
     }
   }
@@ -209,222 +462,1773 @@ std::string POCOClient::POCOResult::toString(const bool verbose, const size_t in
  * Class definitions: POCOClient
  */
 
+const std::string POCOClient::RANGE         = "Range";
+const std::string POCOClient::IF_RANGE      = "If-Range";
+const std::string POCOClient::CONTENT_RANGE = "Content-Range";
+
 /************************************************************
  * Primary methods
  */
 
-POCOClient::POCOResult POCOClient::httpGet(const std::string& uri)
-{
-  return makeHTTPRequest(HTTPRequest::HTTP_GET, uri);
-}
-
-POCOClient::POCOResult POCOClient::httpPost(const std::string& uri, const std::string& content)
-{
-  return makeHTTPRequest(HTTPRequest::HTTP_POST, uri, content);
-}
-
-POCOClient::POCOResult POCOClient::httpPut(const std::string& uri, const std::string& content)
-{
-  return makeHTTPRequest(HTTPRequest::HTTP_PUT, uri, content);
-}
-
-POCOClient::POCOResult POCOClient::httpDelete(const std::string& uri)
+POCOClient::POCOResult POCOClient::httpGet(const std::string& uri, const RequestOptions& options)
 {
-  return makeHTTPRequest(HTTPRequest::HTTP_DELETE, uri);
-}
-
-POCOClient::POCOResult POCOClient::makeHTTPRequest(const std::string& method,
-                                                   const std::string& uri,
-                                                   const std::string& content)
-{
-  // Lock the object's mutex. It is released when the method goes out of scope.
-  ScopedLock<Mutex> lock(http_mutex_);
-
-  // Result of the communication.
-  POCOResult result;
-
-  // The response and the request.
-  HTTPResponse response;
-  HTTPRequest request(method, uri, HTTPRequest::HTTP_1_1);
-  request.setCookies(cookies_);
-  request.setContentLength(content.length());
-  if (method == HTTPRequest::HTTP_POST || !content.empty())
-  {
-    request.setContentType("application/x-www-form-urlencoded");
-  }
+  Poco::SharedPtr<Flight> p_flight;
+  bool leader = true;
 
-  // Attempt the communication.
-  try
   {
-    sendAndReceive(result, request, response, content);
+    // Lock the coalescing context's mutex. It is released when the scope is left.
+    ScopedLock<Mutex> lock(coalescing_.mutex);
 
-    // Check if the server has sent an update for the cookies.
-    std::vector<HTTPCookie> temp_cookies;
-    response.getCookies(temp_cookies);
-    for (size_t i = 0; i < temp_cookies.size(); ++i)
+    // Cancellable requests are not coalesced, since cancelling one request would affect the others. Neither are
+    // control requests, since an in-flight request may be waiting for a pooled connection, or be paced.
+    if (coalescing_.enabled && !options.hasRange() && options.getCancellationToken().isNull() &&
+        options.getPriority() != RequestOptions::PRIORITY_CONTROL)
     {
-      if (cookies_.find(temp_cookies[i].getName()) != cookies_.end())
+      ++coalescing_.statistics.requests;
+
+      // Attach to an identical request in flight, unless it could observe an older state, end before the deadline,
+      // or is made with another priority.
+      std::map<std::string, Poco::SharedPtr<Flight> >::iterator i = coalescing_.flights.find(uri);
+
+      if (i != coalescing_.flights.end() && i->second->generation == coalescing_.generation &&
+          i->second->options.getPriority() == options.getPriority() &&
+          (!i->second->options.hasDeadline() ||
+           (options.hasDeadline() && options.getRemainingTime(0) <= i->second->options.getRemainingTime(0))))
       {
-        cookies_.set(temp_cookies[i].getName(), temp_cookies[i].getValue());
+        p_flight = i->second;
+        leader = false;
+        ++coalescing_.statistics.coalesced_requests;
       }
       else
       {
-        cookies_.add(temp_cookies[i].getName(), temp_cookies[i].getValue());
+        p_flight = new Flight(options, coalescing_.generation);
+        coalescing_.flights[uri] = p_flight;
       }
     }
+  }
+
+  if (p_flight.isNull())
+  {
+    return makeHTTPRequest(HTTPRequest::HTTP_GET, uri, "", options);
+  }
 
-    // Check if there was a server error, if so, make another attempt with a clean sheet.
-    if (response.getStatus() >= HTTPResponse::HTTP_INTERNAL_SERVER_ERROR)
+  if (leader)
+  {
+    POCOResult result;
+
+    try
     {
-      http_client_session_.reset();
-      request.erase(HTTPRequest::COOKIE);
-      sendAndReceive(result, request, response, content);
+      result = makeHTTPRequest(HTTPRequest::HTTP_GET, uri, "", options);
     }
-
-    // Check if the request was unauthorized, if so add credentials.
-    if (response.getStatus() == HTTPResponse::HTTP_UNAUTHORIZED)
+    catch (...)
     {
-      authenticate(result, request, response, content);
+      result.exception_message = "httpGet(...): The coalesced request failed";
+      completeFlight(uri, p_flight, result);
+      throw;
     }
 
-    result.status = POCOResult::OK;
+    completeFlight(uri, p_flight, result);
+
+    return result;
   }
-  catch (InvalidArgumentException& e)
+
+  // Lock the coalescing context's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(coalescing_.mutex);
+
+  while (!p_flight->completed)
   {
-    result.status = POCOResult::EXCEPTION_POCO_INVALID_ARGUMENT;
-    result.exception_message = e.displayText();
+    if (!options.hasDeadline())
+    {
+      coalescing_.condition.wait(coalescing_.mutex);
+      continue;
+    }
+
+    long remaining = static_cast<long>((options.getRemainingTime(0) + 999) / 1000);
+
+    if (remaining <= 0 || !coalescing_.condition.tryWait(coalescing_.mutex, remaining))
+    {
+      if (p_flight->completed)
+      {
+        break;
+      }
+
+      POCOResult result;
+      result.status = POCOResult::EXCEPTION_POCO_TIMEOUT;
+      result.exception_message = "httpGet(...): The coalesced request did not complete before the deadline";
+      result.addHTTPRequestInfo(HTTPRequest(HTTPRequest::HTTP_GET, uri, HTTPRequest::HTTP_1_1));
+      return result;
+    }
   }
-  catch (TimeoutException& e)
+
+  return p_flight->result;
+}
+
+std::vector<POCOClient::POCOResult> POCOClient::httpGet(const std::vector<std::string>& uris,
+                                                        const RequestOptions& options)
+{
+  std::vector<POCOResult> results(uris.size());
+  size_t next = 0;
+
+  bool pipelining_enabled = false;
   {
-    result.status = POCOResult::EXCEPTION_POCO_TIMEOUT;
-    result.exception_message = e.displayText();
+    ScopedLock<Mutex> lock(pool_mutex_);
+    pipelining_enabled = pipelining_enabled_;
   }
-  catch (NetException& e)
+
+  if (pipelining_enabled && uris.size() > 1)
   {
-    result.status = POCOResult::EXCEPTION_POCO_NET;
-    result.exception_message = e.displayText();
+    // Pipelining requires an established session, since an authentication challenge would
+    // require each request to be resent. So, if needed, let the first request establish it.
+    bool has_session = false;
+    {
+      ScopedLock<Mutex> lock(authentication_.mutex);
+      has_session = !authentication_.cookies.empty();
+    }
+
+    if (!has_session)
+    {
+      results[next] = makeHTTPRequest(HTTPRequest::HTTP_GET, uris[next], "", options);
+      ++next;
+    }
+
+    next = makePipelinedHTTPRequests(uris, results, next, options);
   }
 
-  if (result.status != POCOResult::OK)
+  // Fall back to serial mode for any remaining requests.
+  for (size_t i = next; i < uris.size(); ++i)
   {
-    cookies_.clear();
-    http_client_session_.reset();
+    results[i] = makeHTTPRequest(HTTPRequest::HTTP_GET, uris[i], "", options);
   }
 
-  return result;
+  return results;
 }
 
-POCOClient::POCOResult POCOClient::webSocketConnect(const std::string& uri,
-                                                    const std::string& protocol,
-                                                    const Poco::Int64 timeout)
+POCOClient::POCOResult POCOClient::httpGet(const std::string& uri, ContentSink& sink, const RequestOptions& options)
 {
-  // Lock the object's mutex. It is released when the method goes out of scope.
-  ScopedLock<Mutex> lock(http_mutex_);
+  return makeHTTPRequest(HTTPRequest::HTTP_GET, uri, "", options, &sink);
+}
 
-  // Result of the communication.
-  POCOResult result;
+POCOClient::POCOResult POCOClient::httpPost(const std::string& uri,
+                                            const std::string& content,
+                                            const RequestOptions& options)
+{
+  return makeHTTPRequest(HTTPRequest::HTTP_POST, uri, content, options);
+}
 
-  // The response and the request.
-  HTTPResponse response;
-  HTTPRequest request(HTTPRequest::HTTP_GET, uri, HTTPRequest::HTTP_1_1);
-  request.set("Sec-WebSocket-Protocol", protocol);
-  request.setCookies(cookies_);
+POCOClient::POCOResult POCOClient::httpPut(const std::string& uri,
+                                           const std::string& content,
+                                           const RequestOptions& options)
+{
+  return makeHTTPRequest(HTTPRequest::HTTP_PUT, uri, content, options);
+}
 
-  // Attempt the communication.
-  try
-  {
-    result.addHTTPRequestInfo(request);
+POCOClient::POCOResult POCOClient::httpPut(const std::string& uri, ContentSource& source, const RequestOptions& options)
+{
+  return makeHTTPRequest(HTTPRequest::HTTP_PUT, uri, "", options, 0, &source);
+}
 
-    {
-      // We must have at least websocket_connect_mutext_.
-      // If a connection already exists, we must also have websocket_use_mutex_.
-      // If not, nobody should have the mutex anyway, so we should get it immediately.
-      ScopedLock<Mutex> connect_lock(websocket_connect_mutex_);
-      ScopedLock<Mutex> use_lock(websocket_use_mutex_);
+POCOClient::POCOResult POCOClient::httpDelete(const std::string& uri, const RequestOptions& options)
+{
+  return makeHTTPRequest(HTTPRequest::HTTP_DELETE, uri, "", options);
+}
 
-      p_websocket_ = new WebSocket(http_client_session_, request, response);
-      p_websocket_->setReceiveTimeout(Poco::Timespan(timeout));
-    }
+std::string POCOClient::getValidator(const NameValueCollection& header)
+{
+  const std::string& etag = header.get("ETag", "");
 
-    result.addHTTPResponseInfo(response);
-    result.status = POCOResult::OK;
+  // Weak entity tags cannot be used for range requests.
+  if (!etag.empty() && etag.compare(0, 2, "W/") != 0)
+  {
+    return etag;
   }
-  catch (InvalidArgumentException& e)
+
+  return header.get("Last-Modified", "");
+}
+
+bool POCOClient::parseContentRange(const std::string& content_range,
+                                   Poco::Int64& first,
+                                   Poco::Int64& last,
+                                   Poco::Int64& total)
+{
+  const std::string prefix = "bytes ";
+  size_t slash = content_range.find('/');
+
+  if (content_range.compare(0, prefix.size(), prefix) != 0 || slash == std::string::npos)
   {
-    result.status = POCOResult::EXCEPTION_POCO_INVALID_ARGUMENT;
-    result.exception_message = e.displayText();
+    return false;
   }
-  catch (TimeoutException& e)
+
+  std::string range = content_range.substr(prefix.size(), slash - prefix.size());
+  std::string length = content_range.substr(slash + 1);
+  char* p_end = 0;
+
+  total = -1;
+  if (length != "*")
   {
-    result.status = POCOResult::EXCEPTION_POCO_TIMEOUT;
-    result.exception_message = e.displayText();
+    total = std::strtoll(length.c_str(), &p_end, 10);
+
+    if (length.empty() || *p_end != '\0' || total < 0)
+    {
+      return false;
+    }
   }
-  catch (WebSocketException& e)
+
+  first = -1;
+  last = -1;
+  if (range != "*")
   {
-    result.status = POCOResult::EXCEPTION_POCO_WEBSOCKET;
-    result.exception_message = e.displayText();
+    size_t dash = range.find('-');
+
+    if (dash == std::string::npos)
+    {
+      return false;
+    }
+
+    first = std::strtoll(range.c_str(), &p_end, 10);
+    bool valid = (dash > 0 && p_end == range.c_str() + dash);
+    last = std::strtoll(range.c_str() + dash + 1, &p_end, 10);
+    valid = valid && dash + 1 < range.size() && *p_end == '\0';
+
+    if (!valid || first < 0 || last < first)
+    {
+      return false;
+    }
   }
-  catch (NetException& e)
+
+  return true;
+}
+
+void POCOClient::setHTTPTimeout(const Poco::Int64 timeout)
+{
+  // Lock the pool's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(pool_mutex_);
+
+  // Leased connections are reconfigured when they are leased the next time.
+  http_timeout_ = timeout;
+
+  for (size_t i = 0; i < idle_connections_.size(); ++i)
   {
-    result.status = POCOResult::EXCEPTION_POCO_NET;
-    result.exception_message = e.displayText();
+    idle_connections_[i]->setTimeout(timeout);
   }
+}
 
-  if (result.status != POCOResult::OK)
+void POCOClient::setConnectionPoolSize(const size_t size)
+{
+  // Lock the pool's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(pool_mutex_);
+
+  connection_pool_size_ = (size > 0 ? size : 1);
+
+  // Close surplus idle connections. Surplus leased connections are closed when they are returned to the pool.
+  while (number_of_connections_ > connection_pool_size_ && !idle_connections_.empty())
   {
-    http_client_session_.reset();
+    idle_connections_.pop_back();
+    --number_of_connections_;
   }
 
-  return result;
+  pool_condition_.broadcast();
 }
 
-POCOClient::POCOResult POCOClient::webSocketReceiveFrame()
+size_t POCOClient::getConnectionPoolSize()
+{
+  // Lock the pool's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(pool_mutex_);
+
+  return connection_pool_size_;
+}
+
+void POCOClient::setWebSocketMaxMessageSize(const size_t size)
 {
   // Lock the object's mutex. It is released when the method goes out of scope.
   ScopedLock<Mutex> lock(websocket_use_mutex_);
 
-  // Result of the communication.
-  POCOResult result;
+  websocket_max_message_size_ = size;
+}
 
-  // Attempt the communication.
-  try
-  {
-    if (!p_websocket_.isNull())
-    {
-      int flags = 0;
-      std::string content;
+void POCOClient::setPreemptiveAuthentication(const bool enabled)
+{
+  // Lock the authentication context's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(authentication_.mutex);
 
-      // Wait for (non-ping) WebSocket frames.
-      do
-      {
-        flags = 0;
-        int number_of_bytes_received = p_websocket_->receiveFrame(websocket_buffer_, sizeof(websocket_buffer_), flags);
-        content = std::string(websocket_buffer_, number_of_bytes_received);
+  authentication_.preemptive = enabled;
+}
 
-        // Check for ping frame.
-        if ((flags & WebSocket::FRAME_OP_BITMASK) == WebSocket::FRAME_OP_PING)
-        {
-          // Reply with a pong frame.
-          p_websocket_->sendFrame(websocket_buffer_,
-                                  number_of_bytes_received,
-                                  WebSocket::FRAME_FLAG_FIN | WebSocket::FRAME_OP_PONG);
-        }
-      } while ((flags & WebSocket::FRAME_OP_BITMASK) == WebSocket::FRAME_OP_PING);
+void POCOClient::setSessionStore(const Poco::SharedPtr<SessionStore>& p_session_store)
+{
+  // Lock the authentication context's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(authentication_.mutex);
 
-      // Check for closing frame.
-      if ((flags & WebSocket::FRAME_OP_BITMASK) == WebSocket::FRAME_OP_CLOSE)
-      {
-        // Do not pass content of a closing frame to end user,
-        // according to "The WebSocket Protocol" RFC6455.
-        content.clear();
+  std::stringstream session_key;
+  session_key << authentication_.credentials.getUsername() << "@" << ip_address_ << ":" << port_;
 
-        // Shutdown the WebSocket.
-        p_websocket_->shutdown();
-        p_websocket_ = 0;
-      }
+  authentication_.p_session_store = p_session_store;
+  authentication_.session_key = session_key.str();
+  authentication_.session_store_loaded = false;
+}
 
-      result.addWebSocketFrameInfo(flags, content);
-      result.status = POCOResult::OK;
+void POCOClient::discardSession()
+{
+  // Lock the authentication context's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(authentication_.mutex);
+
+  authentication_.cookies.clear();
+  ++authentication_.cookies_version;
+
+  if (!authentication_.p_session_store.isNull())
+  {
+    try
+    {
+      authentication_.p_session_store->remove(authentication_.session_key);
+    }
+    catch (const Poco::Exception&)
+    {
+      // The session is still discarded by this client (i.e. only other clients may reuse the stale session).
+      ++authentication_.statistics.session_store_failures;
+    }
+  }
+}
+
+POCOClient::AuthenticationStatistics POCOClient::getAuthenticationStatistics()
+{
+  // Lock the authentication context's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(authentication_.mutex);
+
+  return authentication_.statistics;
+}
+
+void POCOClient::setRetryPolicy(const Poco::SharedPtr<RetryPolicy>& p_retry_policy)
+{
+  // Lock the pool's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(pool_mutex_);
+
+  p_retry_policy_ = p_retry_policy;
+}
+
+void POCOClient::setCircuitBreaker(const Poco::SharedPtr<CircuitBreaker>& p_circuit_breaker)
+{
+  // Lock the pool's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(pool_mutex_);
+
+  p_circuit_breaker_ = p_circuit_breaker;
+}
+
+Poco::SharedPtr<CircuitBreaker> POCOClient::getCircuitBreaker()
+{
+  // Lock the pool's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(pool_mutex_);
+
+  return p_circuit_breaker_;
+}
+
+void POCOClient::setAdaptiveTimeout(const Poco::SharedPtr<AdaptiveTimeout>& p_adaptive_timeout)
+{
+  // Lock the pool's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(pool_mutex_);
+
+  p_adaptive_timeout_ = p_adaptive_timeout;
+}
+
+Poco::SharedPtr<AdaptiveTimeout> POCOClient::getAdaptiveTimeout()
+{
+  // Lock the pool's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(pool_mutex_);
+
+  return p_adaptive_timeout_;
+}
+
+void POCOClient::setConcurrencyLimiter(const Poco::SharedPtr<ConcurrencyLimiter>& p_concurrency_limiter)
+{
+  // Lock the pool's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(pool_mutex_);
+
+  p_concurrency_limiter_ = p_concurrency_limiter;
+}
+
+Poco::SharedPtr<ConcurrencyLimiter> POCOClient::getConcurrencyLimiter()
+{
+  // Lock the pool's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(pool_mutex_);
+
+  return p_concurrency_limiter_;
+}
+
+void POCOClient::setPipeliningEnabled(const bool enabled)
+{
+  // Lock the pool's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(pool_mutex_);
+
+  pipelining_enabled_ = enabled;
+}
+
+void POCOClient::setBandwidthLimiter(const Poco::SharedPtr<BandwidthLimiter>& p_bandwidth_limiter)
+{
+  // Lock the pool's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(pool_mutex_);
+
+  p_bandwidth_limiter_ = p_bandwidth_limiter;
+}
+
+Poco::SharedPtr<BandwidthLimiter> POCOClient::getBandwidthLimiter()
+{
+  // Lock the pool's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(pool_mutex_);
+
+  return p_bandwidth_limiter_;
+}
+
+void POCOClient::setControllerBandwidthLimiter(const Poco::SharedPtr<BandwidthLimiter>& p_bandwidth_limiter)
+{
+  // Lock the pool's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(pool_mutex_);
+
+  p_controller_bandwidth_limiter_ = p_bandwidth_limiter;
+}
+
+Poco::SharedPtr<BandwidthLimiter> POCOClient::getControllerBandwidthLimiter()
+{
+  // Lock the pool's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(pool_mutex_);
+
+  return p_controller_bandwidth_limiter_;
+}
+
+void POCOClient::setControlLaneEnabled(const bool enabled)
+{
+  // Lock the pool's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(pool_mutex_);
+
+  control_lane_enabled_ = enabled;
+
+  if (!enabled)
+  {
+    // An idle reserved connection is closed. A leased one is closed when it is returned.
+    p_control_connection_ = Poco::SharedPtr<HTTPConnection>();
+  }
+
+  pool_condition_.broadcast();
+}
+
+void POCOClient::setRequestCoalescingEnabled(const bool enabled)
+{
+  // Lock the coalescing context's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(coalescing_.mutex);
+
+  coalescing_.enabled = enabled;
+}
+
+POCOClient::CoalescingStatistics POCOClient::getCoalescingStatistics()
+{
+  // Lock the coalescing context's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(coalescing_.mutex);
+
+  return coalescing_.statistics;
+}
+
+POCOClient::POCOResult POCOClient::makeHTTPRequest(const std::string& method,
+                                                   const std::string& uri,
+                                                   const std::string& content,
+                                                   const RequestOptions& options,
+                                                   ContentSink* p_sink,
+                                                   ContentSource* p_source)
+{
+  Poco::SharedPtr<RetryPolicy> p_retry_policy;
+  Poco::SharedPtr<CircuitBreaker> p_circuit_breaker;
+  Poco::SharedPtr<AdaptiveTimeout> p_adaptive_timeout;
+  Poco::SharedPtr<ConcurrencyLimiter> p_concurrency_limiter;
+  Poco::Int64 default_timeout = 0;
+  {
+    ScopedLock<Mutex> lock(pool_mutex_);
+    p_retry_policy = p_retry_policy_;
+    p_adaptive_timeout = p_adaptive_timeout_;
+    default_timeout = http_timeout_;
+
+    // Control commands are never refused by the circuit breaker, nor held back by the concurrency limiter.
+    if (options.getPriority() != RequestOptions::PRIORITY_CONTROL)
+    {
+      p_circuit_breaker = p_circuit_breaker_;
+      p_concurrency_limiter = p_concurrency_limiter_;
+    }
+  }
+
+  std::string endpoint_class;
+  if (!p_adaptive_timeout.isNull() || !p_concurrency_limiter.isNull())
+  {
+    endpoint_class = AdaptiveTimeout::classify(method, uri);
+  }
+
+  // Bulk transfers pause between their chunks while control requests are in progress, and are bandwidth limited.
+  PacingHandler pacing_handler;
+  if (options.getPriority() == RequestOptions::PRIORITY_BULK)
+  {
+    pacing_handler = [this, &options](const size_t size)
+    {
+      yieldToControlRequests(options);
+      limitBandwidth(options, size);
+    };
+  }
+
+  // Keep track of the streamed content, since a partially streamed response cannot be retried.
+  Poco::SharedPtr<ProgressSink> p_progress_sink;
+  if (p_sink)
+  {
+    p_progress_sink = new ProgressSink(*p_sink, options.getProgressHandler(), pacing_handler);
+  }
+
+  Poco::SharedPtr<ProgressSource> p_progress_source;
+  if (p_source)
+  {
+    p_progress_source = new ProgressSource(*p_source, options.getProgressHandler(), pacing_handler);
+  }
+
+  if (!p_retry_policy.isNull())
+  {
+    p_retry_policy->onRequest();
+  }
+
+  POCOResult result;
+  RetryPolicy::Attempt attempt;
+  attempt.method = method;
+
+  while (true)
+  {
+    // Do not start an attempt for a cancelled request.
+    if (options.isCancelled())
+    {
+      result = POCOResult();
+      result.status = POCOResult::CANCELLED;
+      result.exception_message = "makeHTTPRequest(...): The request was cancelled";
+      result.addHTTPRequestInfo(HTTPRequest(method, uri, HTTPRequest::HTTP_1_1), content);
+      break;
+    }
+
+    // Do not start an attempt that cannot be completed before the deadline.
+    if (options.isExpired())
+    {
+      if (attempt.number == 0)
+      {
+        result = POCOResult();
+        result.status = POCOResult::EXCEPTION_POCO_TIMEOUT;
+        result.exception_message = "makeHTTPRequest(...): The deadline has passed";
+        result.addHTTPRequestInfo(HTTPRequest(method, uri, HTTPRequest::HTTP_1_1), content);
+      }
+      break;
+    }
+
+    // Fail fast if the server is deemed unresponsive.
+    if (!p_circuit_breaker.isNull() && !p_circuit_breaker->allowRequest())
+    {
+      if (attempt.number == 0)
+      {
+        result = POCOResult();
+        result.status = POCOResult::CIRCUIT_OPEN;
+        result.exception_message = "makeHTTPRequest(...): The circuit breaker is open";
+        result.addHTTPRequestInfo(HTTPRequest(method, uri, HTTPRequest::HTTP_1_1), content);
+      }
+      break;
+    }
+
+    // An explicit deadline takes precedence over the adaptive timeout.
+    Poco::Int64 timeout = 0;
+    if (!p_adaptive_timeout.isNull() && !options.hasDeadline())
+    {
+      timeout = p_adaptive_timeout->getTimeout(endpoint_class, default_timeout);
+    }
+
+    // Wait for a permit from the concurrency limiter (if any), but not beyond the deadline.
+    Poco::Int64 permit_timeout = (options.hasDeadline() ? std::max<Poco::Int64>(options.getRemainingTime(0), 0) : -1);
+
+    if (!p_concurrency_limiter.isNull() &&
+        !p_concurrency_limiter->acquire(permit_timeout, options.getCancellationToken()))
+    {
+      // The request was allowed by the circuit breaker, but is never sent (so it cannot be its probe).
+      if (!p_circuit_breaker.isNull())
+      {
+        p_circuit_breaker->abandonProbe();
+      }
+
+      if (attempt.number == 0 || options.isCancelled())
+      {
+        result = POCOResult();
+        result.status = (options.isCancelled() ? POCOResult::CANCELLED : POCOResult::EXCEPTION_POCO_TIMEOUT);
+        result.exception_message = "makeHTTPRequest(...): No concurrency permit became available";
+        result.addHTTPRequestInfo(HTTPRequest(method, uri, HTTPRequest::HTTP_1_1), content);
+      }
+      break;
+    }
+
+    try
+    {
+      result = sendHTTPRequest(method, uri, content, options, timeout, p_progress_sink.get(), p_progress_source.get());
+    }
+    catch (...)
+    {
+      if (!p_concurrency_limiter.isNull())
+      {
+        p_concurrency_limiter->release(ConcurrencyLimiter::IGNORED);
+      }
+
+      if (!p_circuit_breaker.isNull())
+      {
+        p_circuit_breaker->abandonProbe();
+      }
+
+      throw;
+    }
+
+    ++attempt.number;
+
+    if (!p_concurrency_limiter.isNull())
+    {
+      // The duration of a streamed transfer depends on the content's size, rather than on the server's load.
+      p_concurrency_limiter->release(classifyOutcome(result, options),
+                                     endpoint_class,
+                                     (p_sink || p_source ? -1 : result.duration));
+    }
+
+    // The failure of a cancelled attempt (e.g. caused by the socket being shut down) says nothing about the server.
+    if (options.isCancelled() && result.status != POCOResult::OK)
+    {
+      result.status = POCOResult::CANCELLED;
+      result.exception_message = "makeHTTPRequest(...): The request was cancelled (" + result.exception_message + ")";
+
+      // Let another request probe the server (if this one was the probe), since no outcome is recorded.
+      if (!p_circuit_breaker.isNull())
+      {
+        p_circuit_breaker->abandonProbe();
+      }
+
+      break;
+    }
+
+    if (!p_adaptive_timeout.isNull())
+    {
+      if (result.status == POCOResult::OK)
+      {
+        p_adaptive_timeout->record(endpoint_class, result.duration);
+      }
+      else if (result.status == POCOResult::EXCEPTION_POCO_TIMEOUT && timeout > 0)
+      {
+        // The round-trip time was (at least) the timeout.
+        p_adaptive_timeout->record(endpoint_class, timeout);
+      }
+    }
+
+    attempt.transport_failure = (result.status == POCOResult::EXCEPTION_POCO_TIMEOUT ||
+                                 result.status == POCOResult::EXCEPTION_POCO_NET);
+    attempt.status = result.poco_info.http.response.status;
+
+    bool server_failure = (!attempt.transport_failure &&
+                           result.status == POCOResult::OK &&
+                           attempt.status >= HTTPResponse::HTTP_INTERNAL_SERVER_ERROR);
+
+    if (!p_circuit_breaker.isNull())
+    {
+      p_circuit_breaker->record(!attempt.transport_failure && !server_failure);
+    }
+
+    if (result.status == POCOResult::OK && attempt.status < HTTPResponse::HTTP_INTERNAL_SERVER_ERROR &&
+        attempt.status != HTTPResponse::HTTP_TOO_MANY_REQUESTS)
+    {
+      break;
+    }
+
+    // A transfer aborted by a sink or source (e.g. a source that cannot be rewound) would only fail again.
+    if (result.status == POCOResult::TRANSFER_ABORTED ||
+        (!p_progress_sink.isNull() && p_progress_sink->getTransferred() > 0))
+    {
+      break;
+    }
+
+    Poco::Int64 delay = (p_retry_policy.isNull() ? -1 : p_retry_policy->getRetryDelay(attempt));
+
+    if (delay < 0 || (options.hasDeadline() && delay >= options.getRemainingTime(0)))
+    {
+      break;
+    }
+
+    Poco::SharedPtr<CancellationToken> p_cancellation_token = options.getCancellationToken();
+
+    if (p_cancellation_token.isNull())
+    {
+      Poco::Thread::sleep(static_cast<long>(delay / 1000));
+    }
+    else
+    {
+      // A cancellation ends the wait (and is detected at the start of the next attempt).
+      p_cancellation_token->waitForCancellation(static_cast<long>(delay / 1000));
+    }
+  }
+
+  // Requests started before a modification has completed must not be coalesced with requests made after it.
+  if (method != HTTPRequest::HTTP_GET)
+  {
+    ScopedLock<Mutex> lock(coalescing_.mutex);
+    ++coalescing_.generation;
+  }
+
+  return result;
+}
+
+void POCOClient::completeFlight(const std::string& uri,
+                                Poco::SharedPtr<Flight> p_flight,
+                                const POCOResult& result)
+{
+  // Lock the coalescing context's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(coalescing_.mutex);
+
+  p_flight->result = result;
+  p_flight->completed = true;
+
+  std::map<std::string, Poco::SharedPtr<Flight> >::iterator i = coalescing_.flights.find(uri);
+
+  if (i != coalescing_.flights.end() && i->second.get() == p_flight.get())
+  {
+    coalescing_.flights.erase(i);
+  }
+
+  coalescing_.condition.broadcast();
+}
+
+POCOClient::POCOResult POCOClient::sendHTTPRequest(const std::string& method,
+                                                   const std::string& uri,
+                                                   const std::string& content,
+                                                   const RequestOptions& options,
+                                                   const Poco::Int64 timeout,
+                                                   ContentSink* p_sink,
+                                                   ContentSource* p_source)
+{
+  // Result of the communication.
+  POCOResult result;
+  Poco::Timestamp start_time;
+
+  // Lease a connection from the pool. It is returned when the method goes out of scope.
+  ConnectionLease lease(*this, options, timeout);
+
+  // Note: A cancellation after this check shuts down the leased connection's socket.
+  if (options.isCancelled())
+  {
+    result.status = POCOResult::CANCELLED;
+    result.exception_message = "sendHTTPRequest(...): The request was cancelled";
+    result.addHTTPRequestInfo(HTTPRequest(method, uri, HTTPRequest::HTTP_1_1), content);
+    result.duration = start_time.elapsed();
+    return result;
+  }
+
+  if (!lease.isValid())
+  {
+    result.status = POCOResult::EXCEPTION_POCO_TIMEOUT;
+    result.exception_message = "sendHTTPRequest(...): No connection became available before the deadline";
+    result.addHTTPRequestInfo(HTTPRequest(method, uri, HTTPRequest::HTTP_1_1), content);
+    result.duration = start_time.elapsed();
+    return result;
+  }
+
+  HTTPConnection& connection = lease.connection();
+  adoptSharedCookies(connection);
+  const unsigned int cookies_version = connection.cookies_version;
+
+  // Do not count the time spent waiting for the connection.
+  start_time.update();
+
+  // The response and the request.
+  HTTPResponse response;
+  HTTPRequest request(method, uri, HTTPRequest::HTTP_1_1);
+  request.setCookies(connection.cookies);
+
+  // The length of streamed content is set when it is sent (see sendContent(...)).
+  if (!p_source)
+  {
+    request.setContentLength(content.length());
+  }
+
+  // Without a session, authorize up front (if a challenge has been cached) to avoid the HTTP 401 round trip.
+  bool preemptive = connection.cookies.empty() && authorizePreemptively(request);
+
+  if (method == HTTPRequest::HTTP_POST || !content.empty() || p_source)
+  {
+    request.setContentType("application/x-www-form-urlencoded");
+  }
+
+  if (options.hasRange())
+  {
+    std::stringstream range;
+    range << "bytes=" << options.getRangeFirst() << "-";
+
+    if (options.getRangeLast() >= 0)
+    {
+      range << options.getRangeLast();
+    }
+
+    request.set(RANGE, range.str());
+
+    if (!options.getRangeValidator().empty())
+    {
+      request.set(IF_RANGE, options.getRangeValidator());
+    }
+  }
+
+  // Attempt the communication.
+  try
+  {
+    sendAndReceive(connection, result, request, response, content, p_sink, p_source);
+
+    // Check if the request was unauthorized, if so (re)establish the session.
+    if (response.getStatus() == HTTPResponse::HTTP_UNAUTHORIZED)
+    {
+      {
+        ScopedLock<Mutex> lock(authentication_.mutex);
+        ++authentication_.statistics.challenges;
+
+        if (preemptive)
+        {
+          ++authentication_.statistics.rejected_preemptive_authorizations;
+        }
+      }
+
+      reauthenticate(connection, result, request, response, content, cookies_version, p_sink, p_source);
+    }
+    else
+    {
+      // Check if the server has sent an update for the cookies.
+      updateCookies(connection, response);
+    }
+
+    result.status = POCOResult::OK;
+  }
+  catch (InvalidArgumentException& e)
+  {
+    result.status = POCOResult::EXCEPTION_POCO_INVALID_ARGUMENT;
+    result.exception_message = e.displayText();
+  }
+  catch (TimeoutException& e)
+  {
+    result.status = POCOResult::EXCEPTION_POCO_TIMEOUT;
+    result.exception_message = e.displayText();
+  }
+  catch (NetException& e)
+  {
+    result.status = POCOResult::EXCEPTION_POCO_NET;
+    result.exception_message = e.displayText();
+  }
+  catch (IOException& e)
+  {
+    result.status = POCOResult::TRANSFER_ABORTED;
+    result.exception_message = e.displayText();
+  }
+
+  if (result.status != POCOResult::OK)
+  {
+    // Only the connection is affected, i.e. the session (and its cookies) remains valid on the server.
+    connection.reset();
+  }
+
+  result.duration = start_time.elapsed();
+
+  return result;
+}
+
+POCOClient::POCOResult POCOClient::webSocketConnect(const std::string& uri,
+                                                    const std::string& protocol,
+                                                    const Poco::Int64 timeout)
+{
+  // Lease a connection from the pool. It is returned when the method goes out of scope.
+  ConnectionLease lease(*this);
+  HTTPConnection& connection = lease.connection();
+  adoptSharedCookies(connection);
+
+  // Result of the communication.
+  POCOResult result;
+  Poco::Timestamp start_time;
+
+  // The response and the request.
+  HTTPResponse response;
+  HTTPRequest request(HTTPRequest::HTTP_GET, uri, HTTPRequest::HTTP_1_1);
+  request.set("Sec-WebSocket-Protocol", protocol);
+  request.setCookies(connection.cookies);
+
+  // Attempt the communication.
+  try
+  {
+    result.addHTTPRequestInfo(request);
+
+    {
+      // We must have at least websocket_connect_mutext_.
+      // If a connection already exists, we must also have websocket_use_mutex_.
+      // If not, nobody should have the mutex anyway, so we should get it immediately.
+      ScopedLock<Mutex> connect_lock(websocket_connect_mutex_);
+      ScopedLock<Mutex> use_lock(websocket_use_mutex_);
+
+      // Note: The WebSocket takes over the session's socket, and the session reconnects on its next request.
+      p_websocket_ = new WebSocket(connection.session, request, response);
+      p_websocket_->setReceiveTimeout(Poco::Timespan(timeout));
+      websocket_last_frame_time_.update();
+    }
+
+    result.addHTTPResponseInfo(response);
+    result.status = POCOResult::OK;
+  }
+  catch (InvalidArgumentException& e)
+  {
+    result.status = POCOResult::EXCEPTION_POCO_INVALID_ARGUMENT;
+    result.exception_message = e.displayText();
+  }
+  catch (TimeoutException& e)
+  {
+    result.status = POCOResult::EXCEPTION_POCO_TIMEOUT;
+    result.exception_message = e.displayText();
+  }
+  catch (WebSocketException& e)
+  {
+    result.status = POCOResult::EXCEPTION_POCO_WEBSOCKET;
+    result.exception_message = e.displayText();
+  }
+  catch (NetException& e)
+  {
+    result.status = POCOResult::EXCEPTION_POCO_NET;
+    result.exception_message = e.displayText();
+  }
+
+  if (result.status != POCOResult::OK)
+  {
+    connection.reset();
+  }
+
+  result.duration = start_time.elapsed();
+
+  return result;
+}
+
+POCOClient::POCOResult POCOClient::webSocketReceiveFrame()
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(websocket_use_mutex_);
+
+  POCOResult result = receiveWebSocketMessage(websocket_buffer_);
+
+  if (result.status == POCOResult::OK)
+  {
+    result.addWebSocketFrameInfo(result.poco_info.websocket.flags,
+                                 new std::string(websocket_buffer_.begin(), websocket_buffer_.size()));
+  }
+
+  return result;
+}
+
+POCOClient::POCOResult POCOClient::webSocketReceiveFrame(Poco::Buffer<char>& buffer)
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(websocket_use_mutex_);
+
+  return receiveWebSocketMessage(buffer);
+}
+
+POCOClient::POCOResult POCOClient::webSocketPing()
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(websocket_use_mutex_);
+
+  // Result of the communication.
+  POCOResult result;
+  Poco::Timestamp start_time;
+
+  // Attempt the communication.
+  try
+  {
+    if (!p_websocket_.isNull())
+    {
+      p_websocket_->sendFrame(0, 0, WebSocket::FRAME_FLAG_FIN | WebSocket::FRAME_OP_PING);
+      result.status = POCOResult::OK;
+    }
+    else
+    {
+      result.status = POCOResult::WEBSOCKET_NOT_ALLOCATED;
+    }
+  }
+  catch (TimeoutException& e)
+  {
+    result.status = POCOResult::EXCEPTION_POCO_TIMEOUT;
+    result.exception_message = e.displayText();
+  }
+  catch (WebSocketException& e)
+  {
+    result.status = POCOResult::EXCEPTION_POCO_WEBSOCKET;
+    result.exception_message = e.displayText();
+  }
+  catch (NetException& e)
+  {
+    result.status = POCOResult::EXCEPTION_POCO_NET;
+    result.exception_message = e.displayText();
+  }
+
+  result.duration = start_time.elapsed();
+
+  return result;
+}
+
+Poco::Timestamp POCOClient::webSocketLastFrameTime()
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(websocket_use_mutex_);
+
+  return websocket_last_frame_time_;
+}
+
+void POCOClient::webSocketShutdown()
+{
+  // Make sure nobody is connecting while we're closing.
+  ScopedLock<Mutex> connect_lock(websocket_connect_mutex_);
+
+  // Make sure there is actually a connection to close.
+  if (!webSocketExist())
+  {
+    return;
+  }
+
+  // Shut down the socket. This should make webSocketReceiveFrame() return as soon as possible.
+  p_websocket_->shutdown();
+
+  // Also acquire the websocket lock before invalidating the pointer,
+  // or we will break running calls to webSocketReceiveFrame().
+  ScopedLock<Mutex> use_lock(websocket_use_mutex_);
+  p_websocket_ = Poco::SharedPtr<Poco::Net::WebSocket>();
+}
+
+/************************************************************
+ * Auxiliary methods
+ */
+
+Poco::SharedPtr<POCOClient::HTTPConnection> POCOClient::acquireConnection(const RequestOptions& options,
+                                                                          const Poco::Int64 timeout)
+{
+  // Wake the waiting requests if the request is cancelled (registered before the pool's mutex is locked, since the
+  // callback locks it while the token's mutex is held).
+  CancellationToken::Registration registration(options.getCancellationToken(), [this]()
+  {
+    ScopedLock<Mutex> lock(pool_mutex_);
+    pool_condition_.broadcast();
+  });
+
+  // Lock the pool's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(pool_mutex_);
+
+  const RequestOptions::Priority priority = options.getPriority();
+
+  // Let waiting requests with normal priority go before bulk requests.
+  bool waiting = false;
+
+  // Wait until a connection is available for the request's priority (or the request is cancelled).
+  while (!isConnectionAvailable(priority) || options.isCancelled())
+  {
+    Poco::Int64 remaining_time = options.getRemainingTime(0);
+
+    if (options.isCancelled() || (options.hasDeadline() && remaining_time <= 0))
+    {
+      if (waiting)
+      {
+        --waiting_requests_;
+        pool_condition_.broadcast();
+      }
+
+      return Poco::SharedPtr<HTTPConnection>();
+    }
+
+    if (!waiting && priority == RequestOptions::PRIORITY_NORMAL)
+    {
+      ++waiting_requests_;
+      waiting = true;
+    }
+
+    if (!options.hasDeadline())
+    {
+      pool_condition_.wait(pool_mutex_);
+    }
+    else
+    {
+      // Round up, so that the wait does not end just before the deadline.
+      pool_condition_.tryWait(pool_mutex_, static_cast<long>((remaining_time + 999) / 1000));
+    }
+  }
+
+  if (waiting)
+  {
+    // Bulk requests may be waiting for this request to go first.
+    --waiting_requests_;
+    pool_condition_.broadcast();
+  }
+
+  Poco::SharedPtr<HTTPConnection> p_connection;
+
+  if (priority == RequestOptions::PRIORITY_CONTROL && control_lane_enabled_ && !control_connection_leased_)
+  {
+    // Prefer the reserved connection, to leave the pooled connections to other requests.
+    if (p_control_connection_.isNull())
+    {
+      p_control_connection_ = new HTTPConnection(ip_address_, port_, http_timeout_);
+      p_control_connection_->reserved = true;
+    }
+
+    p_connection = p_control_connection_;
+    p_control_connection_ = Poco::SharedPtr<HTTPConnection>();
+    control_connection_leased_ = true;
+  }
+  else if (!idle_connections_.empty())
+  {
+    p_connection = idle_connections_.back();
+    idle_connections_.pop_back();
+  }
+  else
+  {
+    p_connection = new HTTPConnection(ip_address_, port_, http_timeout_);
+    ++number_of_connections_;
+  }
+
+  p_connection->priority = priority;
+
+  if (priority == RequestOptions::PRIORITY_CONTROL)
+  {
+    ++control_requests_;
+  }
+
+  // Bound the connection's socket operations by the deadline (if any). The connection stays open.
+  Poco::Int64 connection_timeout = options.getRemainingTime(timeout > 0 ? timeout : http_timeout_);
+  p_connection->setTimeout(connection_timeout > 0 ? connection_timeout : 1);
+
+  return p_connection;
+}
+
+void POCOClient::releaseConnection(Poco::SharedPtr<HTTPConnection> p_connection)
+{
+  // Lock the pool's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(pool_mutex_);
+
+  if (p_connection->priority == RequestOptions::PRIORITY_CONTROL)
+  {
+    --control_requests_;
+  }
+
+  if (p_connection->reserved)
+  {
+    control_connection_leased_ = false;
+
+    // The reserved connection is closed if the control lane has been disabled while it was leased.
+    if (control_lane_enabled_)
+    {
+      p_control_connection_ = p_connection;
+    }
+  }
+  else if (number_of_connections_ > connection_pool_size_)
+  {
+    // The pool has been shrunk while the connection was leased, so close it.
+    --number_of_connections_;
+  }
+  else
+  {
+    idle_connections_.push_back(p_connection);
+  }
+
+  // Wake all waiters, since they wait for different conditions (i.e. depending on their priorities).
+  pool_condition_.broadcast();
+}
+
+bool POCOClient::isConnectionAvailable(const RequestOptions::Priority priority)
+{
+  bool pooled_available = (!idle_connections_.empty() || number_of_connections_ < connection_pool_size_);
+
+  switch (priority)
+  {
+    case RequestOptions::PRIORITY_CONTROL:
+      return pooled_available || (control_lane_enabled_ && !control_connection_leased_);
+
+    case RequestOptions::PRIORITY_BULK:
+      return pooled_available && waiting_requests_ == 0;
+
+    default:
+      return pooled_available;
+  }
+}
+
+void POCOClient::yieldToControlRequests(const RequestOptions& options)
+{
+  // Lock the pool's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(pool_mutex_);
+
+  Poco::Timestamp start_time;
+
+  while (control_requests_ > 0 && !options.isCancelled())
+  {
+    Poco::Int64 remaining_time = std::min(MAX_BULK_PAUSE - start_time.elapsed(),
+                                          options.getRemainingTime(MAX_BULK_PAUSE));
+
+    if (remaining_time <= 0)
+    {
+      break;
+    }
+
+    pool_condition_.tryWait(pool_mutex_, static_cast<long>((remaining_time + 999) / 1000));
+  }
+}
+
+void POCOClient::limitBandwidth(const RequestOptions& options, const size_t size)
+{
+  Poco::SharedPtr<BandwidthLimiter> p_bandwidth_limiter;
+  Poco::SharedPtr<BandwidthLimiter> p_controller_bandwidth_limiter;
+  {
+    ScopedLock<Mutex> lock(pool_mutex_);
+    p_bandwidth_limiter = p_bandwidth_limiter_;
+    p_controller_bandwidth_limiter = p_controller_bandwidth_limiter_;
+  }
+
+  // Reserve the chunk in both buckets, and wait for the one that has been drained the most.
+  Poco::Int64 delay = 0;
+
+  if (!p_bandwidth_limiter.isNull())
+  {
+    delay = p_bandwidth_limiter->reserve(size);
+  }
+
+  if (!p_controller_bandwidth_limiter.isNull())
+  {
+    delay = std::max(delay, p_controller_bandwidth_limiter->reserve(size));
+  }
+
+  // Do not wait beyond the deadline (the transfer is then ended by its timeout).
+  delay = std::min(delay, options.getRemainingTime(delay));
+
+  if (delay > 0)
+  {
+    Poco::SharedPtr<CancellationToken> p_cancellation_token = options.getCancellationToken();
+
+    if (p_cancellation_token.isNull())
+    {
+      Poco::Thread::sleep(static_cast<long>((delay + 999) / 1000));
+    }
+    else
+    {
+      p_cancellation_token->waitForCancellation(static_cast<long>((delay + 999) / 1000));
+    }
+  }
+}
+
+ConcurrencyLimiter::Outcome POCOClient::classifyOutcome(const POCOResult& result, const RequestOptions& options)
+{
+  if (options.isCancelled())
+  {
+    return ConcurrencyLimiter::IGNORED;
+  }
+
+  if (result.status == POCOResult::EXCEPTION_POCO_TIMEOUT)
+  {
+    return ConcurrencyLimiter::OVERLOAD;
+  }
+
+  if (result.status != POCOResult::OK)
+  {
+    return ConcurrencyLimiter::IGNORED;
+  }
+
+  if (result.poco_info.http.response.status == HTTPResponse::HTTP_SERVICE_UNAVAILABLE ||
+      result.poco_info.http.response.status == HTTPResponse::HTTP_TOO_MANY_REQUESTS)
+  {
+    return ConcurrencyLimiter::OVERLOAD;
+  }
+
+  return ConcurrencyLimiter::SUCCESS;
+}
+
+size_t POCOClient::makePipelinedHTTPRequests(const std::vector<std::string>& uris,
+                                             std::vector<POCOResult>& results,
+                                             size_t first,
+                                             const RequestOptions& options)
+{
+  Poco::SharedPtr<RetryPolicy> p_retry_policy;
+  Poco::SharedPtr<CircuitBreaker> p_circuit_breaker;
+  Poco::SharedPtr<AdaptiveTimeout> p_adaptive_timeout;
+  Poco::SharedPtr<ConcurrencyLimiter> p_concurrency_limiter;
+  Poco::Int64 default_timeout = 0;
+  {
+    ScopedLock<Mutex> lock(pool_mutex_);
+    p_retry_policy = p_retry_policy_;
+    p_adaptive_timeout = p_adaptive_timeout_;
+    default_timeout = http_timeout_;
+
+    // Control commands are never refused by the circuit breaker, nor held back by the concurrency limiter.
+    if (options.getPriority() != RequestOptions::PRIORITY_CONTROL)
+    {
+      p_circuit_breaker = p_circuit_breaker_;
+      p_concurrency_limiter = p_concurrency_limiter_;
+    }
+  }
+
+  // The remaining requests are sent one by one (which reports them as cancelled, expired or refused, if so).
+  if (first >= uris.size() || options.isCancelled() || options.isExpired())
+  {
+    return first;
+  }
+
+  // The burst occupies one connection, so it is admitted (and its outcome recorded) as one request.
+  const std::string endpoint_class = AdaptiveTimeout::classify(HTTPRequest::HTTP_GET, uris[first]);
+
+  if (!p_circuit_breaker.isNull() && !p_circuit_breaker->allowRequest())
+  {
+    return first;
+  }
+
+  // An explicit deadline takes precedence over the adaptive timeout.
+  Poco::Int64 timeout = 0;
+  if (!p_adaptive_timeout.isNull() && !options.hasDeadline())
+  {
+    timeout = p_adaptive_timeout->getTimeout(endpoint_class, default_timeout);
+  }
+
+  // Wait for a permit from the concurrency limiter (if any), but not beyond the deadline.
+  Poco::Int64 permit_timeout = (options.hasDeadline() ? std::max<Poco::Int64>(options.getRemainingTime(0), 0) : -1);
+
+  if (!p_concurrency_limiter.isNull() &&
+      !p_concurrency_limiter->acquire(permit_timeout, options.getCancellationToken()))
+  {
+    // The burst was allowed by the circuit breaker, but is never sent (so it cannot be its probe).
+    if (!p_circuit_breaker.isNull())
+    {
+      p_circuit_breaker->abandonProbe();
+    }
+
+    return first;
+  }
+
+  POCOResult outcome;
+  size_t next = first;
+
+  try
+  {
+    next = sendPipelinedHTTPRequests(uris, results, first, options, timeout, outcome);
+  }
+  catch (...)
+  {
+    if (!p_concurrency_limiter.isNull())
+    {
+      p_concurrency_limiter->release(ConcurrencyLimiter::IGNORED);
+    }
+
+    if (!p_circuit_breaker.isNull())
+    {
+      p_circuit_breaker->abandonProbe();
+    }
+
+    throw;
+  }
+
+  if (!p_concurrency_limiter.isNull())
+  {
+    p_concurrency_limiter->release(classifyOutcome(outcome, options), endpoint_class, outcome.duration);
+  }
+
+  const bool transport_failure = (outcome.status == POCOResult::EXCEPTION_POCO_TIMEOUT ||
+                                  outcome.status == POCOResult::EXCEPTION_POCO_NET);
+
+  // Nothing is recorded if the burst was cancelled, or ended without a verdict (e.g. by an authentication challenge).
+  if (options.isCancelled() || (outcome.status != POCOResult::OK && !transport_failure))
+  {
+    if (!p_circuit_breaker.isNull())
+    {
+      p_circuit_breaker->abandonProbe();
+    }
+  }
+  else
+  {
+    if (!p_adaptive_timeout.isNull())
+    {
+      if (outcome.status == POCOResult::OK)
+      {
+        p_adaptive_timeout->record(endpoint_class, outcome.duration);
+      }
+      else if (outcome.status == POCOResult::EXCEPTION_POCO_TIMEOUT && timeout > 0)
+      {
+        // The round-trip time was (at least) the timeout.
+        p_adaptive_timeout->record(endpoint_class, timeout);
+      }
+    }
+
+    if (!p_circuit_breaker.isNull())
+    {
+      p_circuit_breaker->record(!transport_failure &&
+                                outcome.poco_info.http.response.status < HTTPResponse::HTTP_INTERNAL_SERVER_ERROR);
+    }
+  }
+
+  // The completed requests count towards the retry budget (the others are resent, and counted, one by one).
+  if (!p_retry_policy.isNull())
+  {
+    for (size_t i = first; i < next; ++i)
+    {
+      p_retry_policy->onRequest();
+    }
+  }
+
+  return next;
+}
+
+size_t POCOClient::sendPipelinedHTTPRequests(const std::vector<std::string>& uris,
+                                             std::vector<POCOResult>& results,
+                                             size_t first,
+                                             const RequestOptions& options,
+                                             const Poco::Int64 timeout,
+                                             POCOResult& outcome)
+{
+  // Lease a connection from the pool. It is returned when the method goes out of scope.
+  ConnectionLease lease(*this, options, timeout);
+
+  // The remaining requests are sent one by one (which reports them as cancelled, if so).
+  if (!lease.isValid() || options.isCancelled())
+  {
+    return first;
+  }
+
+  HTTPConnection& connection = lease.connection();
+  adoptSharedCookies(connection);
+
+  size_t next = first;
+
+  if (connection.cookies.empty() || first >= uris.size())
+  {
+    return next;
+  }
+
+  Poco::Timestamp start_time;
+
+  try
+  {
+    // Write all requests back to back.
+    for (size_t i = first; i < uris.size(); ++i)
+    {
+      HTTPRequest request(HTTPRequest::HTTP_GET, uris[i], HTTPRequest::HTTP_1_1);
+      request.setCookies(connection.cookies);
+      request.setContentLength(0);
+      results[i].addHTTPRequestInfo(request);
+      connection.sendRequest(request);
+    }
+
+    // Read the responses in order.
+    for (size_t i = first; i < uris.size(); ++i)
+    {
+      HTTPResponse response;
+      std::istream& response_stream = connection.session.receiveResponse(response);
+      Poco::SharedPtr<const std::string> p_response_content = readContent(response_stream, response);
+
+      // Leave authentication challenges to the serial mode, which resends the request.
+      if (response.getStatus() == HTTPResponse::HTTP_UNAUTHORIZED)
+      {
+        break;
+      }
+
+      updateCookies(connection, response);
+
+      // The burst's outcome is that of its last response (with the round-trip time of its first response).
+      outcome.addHTTPResponseInfo(response);
+      outcome.status = POCOResult::OK;
+
+      if (i == first)
+      {
+        outcome.duration = start_time.elapsed();
+      }
+
+      // Leave responses that the retry policy may retry to the serial mode.
+      if (response.getStatus() >= HTTPResponse::HTTP_INTERNAL_SERVER_ERROR ||
+          response.getStatus() == HTTPResponse::HTTP_TOO_MANY_REQUESTS)
+      {
+        break;
+      }
+
+      results[i].addHTTPResponseInfo(response, p_response_content);
+      results[i].status = POCOResult::OK;
+      results[i].duration = start_time.elapsed();
+      next = i + 1;
+
+      // Stop if the server is about to close the connection (the remaining requests will not be answered).
+      if (!response.getKeepAlive())
+      {
+        break;
+      }
+    }
+  }
+  catch (TimeoutException& e)
+  {
+    outcome.status = POCOResult::EXCEPTION_POCO_TIMEOUT;
+    outcome.exception_message = e.displayText();
+  }
+  catch (NetException& e)
+  {
+    // The connection was lost (e.g. closed by the server), so fall back to serial mode.
+    outcome.status = POCOResult::EXCEPTION_POCO_NET;
+    outcome.exception_message = e.displayText();
+  }
+  catch (Poco::Exception& e)
+  {
+    // E.g. a malformed response, which says nothing about the server's health.
+    outcome.status = POCOResult::UNKNOWN;
+    outcome.exception_message = e.displayText();
+  }
+
+  if (next < uris.size())
+  {
+    // Discard any unread responses.
+    connection.reset();
+  }
+
+  return next;
+}
+
+void POCOClient::streamContent(HTTPConnection& connection,
+                               std::istream& response_stream,
+                               const HTTPResponse& response,
+                               ContentSink& sink,
+                               const Poco::UInt64 skip)
+{
+  const Poco::Int64 content_length = (response.hasContentLength() ? response.getContentLength64() : -1);
+  Poco::Int64 transferred = 0;
+  Poco::Int64 skipped = 0;
+  Poco::Buffer<char> buffer(STREAM_CHUNK_SIZE);
+
+  sink.begin(content_length >= 0 ? std::max(content_length - static_cast<Poco::Int64>(skip), Poco::Int64(0)) : -1);
+
+  while (response_stream.good())
+  {
+    response_stream.read(buffer.begin(), static_cast<std::streamsize>(buffer.size()));
+    std::streamsize size = response_stream.gcount();
+    transferred += size;
+
+    // Discard the leading bytes (e.g. the ones that precede a range which the server has ignored).
+    std::streamsize offset = 0;
+    if (skipped < static_cast<Poco::Int64>(skip))
+    {
+      offset = static_cast<std::streamsize>(std::min(static_cast<Poco::Int64>(skip) - skipped, Poco::Int64(size)));
+      skipped += offset;
+    }
+
+    if (size > offset && !sink.write(buffer.begin() + offset, static_cast<size_t>(size - offset)))
+    {
+      throw IOException("The content sink aborted the transfer");
+    }
+  }
+
+  // The stream swallows exceptions from the session (e.g. timeouts), so check explicitly that nothing was lost.
+  if (response_stream.bad())
+  {
+    if (connection.session.networkException())
+    {
+      connection.session.networkException()->rethrow();
+    }
+
+    throw NetException("The response's content could not be read");
+  }
+
+  if (content_length >= 0 && transferred < content_length)
+  {
+    throw NetException("The response's content was truncated");
+  }
+
+  if (skipped < static_cast<Poco::Int64>(skip))
+  {
+    throw IOException("The response's content ended before the requested range");
+  }
+}
+
+Poco::UInt64 POCOClient::checkRange(const HTTPRequest& request, const HTTPResponse& response)
+{
+  const std::string& range = request.get(RANGE, "");
+  const std::string prefix = "bytes=";
+
+  if (range.compare(0, prefix.size(), prefix) != 0)
+  {
+    return 0;
+  }
+
+  const Poco::Int64 first = std::strtoll(range.c_str() + prefix.size(), 0, 10);
+
+  if (response.getStatus() == HTTPResponse::HTTP_PARTIAL_CONTENT)
+  {
+    Poco::Int64 content_first = -1;
+    Poco::Int64 content_last = -1;
+    Poco::Int64 total = -1;
+
+    if (!parseContentRange(response.get(CONTENT_RANGE, ""), content_first, content_last, total) ||
+        content_first != first)
+    {
+      throw IOException("The response's content range does not match the requested range");
+    }
+
+    return 0;
+  }
+
+  // The server has sent the complete content, i.e. it has ignored the range, or the resource has changed.
+  const std::string& validator = request.get(IF_RANGE, "");
+
+  if (!validator.empty() && getValidator(response) != validator)
+  {
+    throw IOException("The resource has changed since the requested range's validator was obtained");
+  }
+
+  return static_cast<Poco::UInt64>(first);
+}
+
+void POCOClient::sendContent(HTTPConnection& connection, HTTPRequest& request, ContentSource& source)
+{
+  // The content is (re)sent from the beginning, e.g. after an authentication challenge.
+  if (!source.rewind())
+  {
+    throw IOException("The content source cannot be rewound, so the request cannot be resent");
+  }
+
+  const Poco::Int64 content_length = source.getLength();
+
+  if (content_length >= 0)
+  {
+    request.setChunkedTransferEncoding(false);
+    request.setContentLength64(content_length);
+  }
+  else
+  {
+    request.setChunkedTransferEncoding(true);
+  }
+
+  std::ostream& request_stream = connection.sendRequest(request);
+  Poco::Int64 transferred = 0;
+  const char* data = 0;
+  size_t size = 0;
+
+  while (request_stream.good() && source.next(data, size))
+  {
+    request_stream.write(data, static_cast<std::streamsize>(size));
+    transferred += static_cast<Poco::Int64>(size);
+  }
+
+  request_stream.flush();
+
+  // The stream swallows exceptions from the session (e.g. timeouts), so check explicitly that nothing was lost.
+  if (request_stream.bad())
+  {
+    if (connection.session.networkException())
+    {
+      connection.session.networkException()->rethrow();
+    }
+
+    throw NetException("The request's content could not be sent");
+  }
+
+  if (content_length >= 0 && transferred != content_length)
+  {
+    throw IOException("The content source did not match its length");
+  }
+}
+
+Poco::SharedPtr<std::string> POCOClient::readContent(std::istream& response_stream, const HTTPResponse& response)
+{
+  Poco::SharedPtr<std::string> p_content(new std::string());
+
+  if (response.hasContentLength() && response.getContentLength64() > 0)
+  {
+    p_content->reserve(static_cast<size_t>(response.getContentLength64()));
+  }
+
+  StreamCopier::copyToString(response_stream, *p_content);
+
+  return p_content;
+}
+
+POCOClient::POCOResult POCOClient::receiveWebSocketMessage(Poco::Buffer<char>& buffer)
+{
+  // Result of the communication.
+  POCOResult result;
+  Poco::Timestamp start_time;
+
+  // Attempt the communication.
+  try
+  {
+    if (!p_websocket_.isNull())
+    {
+      int flags = 0;
+      int message_flags = 0;
+      bool message_started = false;
+      bool message_too_large = false;
+
+      buffer.resize(0);
+
+      // Wait for (non-control) WebSocket frames, and reassemble them until the final frame of a message.
+      while (true)
+      {
+        const size_t message_size = buffer.size();
+
+        flags = 0;
+        int number_of_bytes_received = p_websocket_->receiveFrame(buffer, flags);
+        websocket_last_frame_time_.update();
+        int opcode = flags & WebSocket::FRAME_OP_BITMASK;
+
+        // Check if the peer has closed the connection.
+        if (number_of_bytes_received == 0 && flags == 0)
+        {
+          message_flags = 0;
+          break;
+        }
+
+        // Check for ping frame (which may be interleaved with the frames of a fragmented message).
+        if (opcode == WebSocket::FRAME_OP_PING)
+        {
+          // Reply with a pong frame.
+          p_websocket_->sendFrame(buffer.begin() + message_size,
+                                  static_cast<int>(buffer.size() - message_size),
+                                  WebSocket::FRAME_FLAG_FIN | WebSocket::FRAME_OP_PONG);
+          buffer.resize(message_size);
+          continue;
+        }
+
+        // Ignore unsolicited pong frames.
+        if (opcode == WebSocket::FRAME_OP_PONG)
+        {
+          buffer.resize(message_size);
+          continue;
+        }
+
+        // Check for closing frame.
+        if (opcode == WebSocket::FRAME_OP_CLOSE)
+        {
+          // Do not pass content of a closing frame to end user,
+          // according to "The WebSocket Protocol" RFC6455.
+          buffer.resize(0);
+          message_flags = flags;
+
+          // Shutdown the WebSocket.
+          p_websocket_->shutdown();
+          p_websocket_ = 0;
+          break;
+        }
+
+        // The first frame of a message holds the message's opcode (continuation frames only hold FRAME_OP_CONT).
+        if (!message_started)
+        {
+          message_flags = flags;
+          message_started = true;
+        }
+
+        // Discard the rest of a too large message, but keep reading it to stay in sync with the frame stream.
+        if (message_too_large || buffer.size() > websocket_max_message_size_)
+        {
+          message_too_large = true;
+          buffer.resize(0);
+        }
+
+        if (flags & WebSocket::FRAME_FLAG_FIN)
+        {
+          message_flags |= WebSocket::FRAME_FLAG_FIN;
+          break;
+        }
+      }
+
+      if (message_too_large)
+      {
+        throw WebSocketException("WebSocket message exceeded the maximum message size");
+      }
+
+      result.poco_info.websocket.flags = message_flags;
+      result.status = POCOResult::OK;
     }
     else
     {
@@ -452,78 +2256,255 @@ POCOClient::POCOResult POCOClient::webSocketReceiveFrame()
     result.exception_message = e.displayText();
   }
 
-  if (result.status != POCOResult::OK)
-  {
-    http_client_session_.reset();
-  }
+  result.duration = start_time.elapsed();
 
   return result;
 }
 
-void POCOClient::webSocketShutdown()
+void POCOClient::sendAndReceive(HTTPConnection& connection,
+                                POCOResult& result,
+                                HTTPRequest& request,
+                                HTTPResponse& response,
+                                const std::string& request_content,
+                                ContentSink* p_sink,
+                                ContentSource* p_source)
 {
-  // Make sure nobody is connecting while we're closing.
-  ScopedLock<Mutex> connect_lock(websocket_connect_mutex_);
+  // Add request info to the result (streamed content is not retained).
+  result.addHTTPRequestInfo(request, request_content);
 
-  // Make sure there is actually a connection to close.
-  if (!webSocketExist())
+  // Contact the server.
+  if (p_source)
   {
-    return;
+    sendContent(connection, request, *p_source);
   }
+  else
+  {
+    connection.sendRequest(request) << request_content;
+  }
+  std::istream& response_stream = connection.session.receiveResponse(response);
 
-  // Shut down the socket. This should make webSocketReceiveFrame() return as soon as possible.
-  p_websocket_->shutdown();
-
-  // Also acquire the websocket lock before invalidating the pointer,
-  // or we will break running calls to webSocketReceiveFrame().
-  ScopedLock<Mutex> use_lock(websocket_use_mutex_);
-  p_websocket_ = Poco::SharedPtr<Poco::Net::WebSocket>();
+  if (p_sink && response.getStatus() >= HTTPResponse::HTTP_OK &&
+      response.getStatus() < HTTPResponse::HTTP_MULTIPLE_CHOICES)
+  {
+    // Stream the content, instead of buffering it in the result.
+    result.addHTTPResponseInfo(response);
+    streamContent(connection, response_stream, response, *p_sink, checkRange(request, response));
+  }
+  else
+  {
+    // Add response info to the result (the content buffer is handed over, not copied).
+    result.addHTTPResponseInfo(response, readContent(response_stream, response));
+  }
 }
 
-/************************************************************
- * Auxiliary methods
- */
-
-void POCOClient::sendAndReceive(POCOResult& result,
+void POCOClient::reauthenticate(HTTPConnection& connection,
+                                POCOResult& result,
                                 HTTPRequest& request,
                                 HTTPResponse& response,
-                                const std::string& request_content)
+                                const std::string& request_content,
+                                const unsigned int cookies_version,
+                                ContentSink* p_sink,
+                                ContentSource* p_source)
 {
-  // Add request info to the result.
-  result.addHTTPRequestInfo(request, request_content);
+  if (!beginAuthentication(connection, cookies_version))
+  {
+    // Another thread has established a new session meanwhile, so resend the request within it.
+    request.erase(HTTPRequest::COOKIE);
+    request.erase(HTTPRequest::AUTHORIZATION);
+    request.setCookies(connection.cookies);
+    sendAndReceive(connection, result, request, response, request_content, p_sink, p_source);
+
+    if (response.getStatus() != HTTPResponse::HTTP_UNAUTHORIZED ||
+        !beginAuthentication(connection, connection.cookies_version))
+    {
+      return;
+    }
+  }
 
-  // Contact the server.
-  std::string response_content;
-  http_client_session_.sendRequest(request) << request_content;
-  StreamCopier::copyToString(http_client_session_.receiveResponse(response), response_content);
+  // Only this thread authenticates. The others wait for it, and then join the new session.
+  try
+  {
+    authenticate(connection, result, request, response, request_content, p_sink, p_source);
+  }
+  catch (...)
+  {
+    endAuthentication();
+    throw;
+  }
+
+  endAuthentication();
+}
+
+bool POCOClient::beginAuthentication(HTTPConnection& connection, const unsigned int cookies_version)
+{
+  // Lock the authentication context's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(authentication_.mutex);
+
+  while (authentication_.authenticating)
+  {
+    authentication_.condition.wait(authentication_.mutex);
+  }
+
+  // Check if the session has been (re)established since the rejected request was sent.
+  if (authentication_.cookies_version != cookies_version && !authentication_.cookies.empty())
+  {
+    connection.cookies = authentication_.cookies;
+    connection.cookies_version = authentication_.cookies_version;
+    ++authentication_.statistics.joined_authentications;
+    return false;
+  }
+
+  authentication_.authenticating = true;
+  ++authentication_.statistics.authentications;
+
+  return true;
+}
+
+void POCOClient::endAuthentication()
+{
+  // Lock the authentication context's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(authentication_.mutex);
 
-  // Add response info to the result.
-  result.addHTTPResponseInfo(response, response_content);
+  authentication_.authenticating = false;
+  authentication_.condition.broadcast();
 }
 
-void POCOClient::authenticate(POCOResult& result,
+void POCOClient::authenticate(HTTPConnection& connection,
+                              POCOResult& result,
                               HTTPRequest& request,
                               HTTPResponse& response,
-                              const std::string& request_content)
+                              const std::string& request_content,
+                              ContentSink* p_sink,
+                              ContentSource* p_source)
 {
   // Remove any old cookies.
-  cookies_.clear();
+  connection.cookies.clear();
+  request.erase(HTTPRequest::COOKIE);
 
-  // Authenticate with the provided credentials.
-  http_credentials_.authenticate(request, response);
+  // Authenticate with the provided (shared) credentials, and cache the answered challenge.
+  {
+    ScopedLock<Mutex> lock(authentication_.mutex);
+    authentication_.credentials.authenticate(request, response);
+    authentication_.authorization = request.get(HTTPRequest::AUTHORIZATION, "");
+  }
 
   // Contact the server, and extract and store the received cookies.
-  sendAndReceive(result, request, response, request_content);
+  sendAndReceive(connection, result, request, response, request_content, p_sink, p_source);
+  std::vector<HTTPCookie> temp_cookies;
+  response.getCookies(temp_cookies);
+
+  for (size_t i = 0; i < temp_cookies.size(); ++i)
+  {
+    extractAndStoreCookie(temp_cookies[i].toString(), connection.cookies);
+  }
+
+  // Let the other connections join the newly established session.
+  if (!connection.cookies.empty())
+  {
+    publishSharedCookies(connection);
+  }
+}
+
+bool POCOClient::authorizePreemptively(HTTPRequest& request)
+{
+  // Lock the authentication context's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(authentication_.mutex);
+
+  if (!authentication_.preemptive || authentication_.authorization.empty())
+  {
+    return false;
+  }
+
+  // Note: The credentials only update an existing authorization (which also identifies the scheme). For Digest,
+  //       the response is recomputed for the request's method and URI, with the next nonce count.
+  request.set(HTTPRequest::AUTHORIZATION, authentication_.authorization);
+  authentication_.credentials.updateAuthInfo(request);
+  authentication_.authorization = request.get(HTTPRequest::AUTHORIZATION);
+  ++authentication_.statistics.preemptive_authorizations;
+
+  return true;
+}
+
+void POCOClient::adoptSharedCookies(HTTPConnection& connection)
+{
+  // Lock the authentication context's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(authentication_.mutex);
+
+  // Check (once) if another client has already established a session that can be reused.
+  if (!authentication_.session_store_loaded && !authentication_.p_session_store.isNull())
+  {
+    authentication_.session_store_loaded = true;
+
+    if (authentication_.cookies.empty() &&
+        authentication_.p_session_store->load(authentication_.session_key, authentication_.cookies))
+    {
+      ++authentication_.cookies_version;
+    }
+  }
+
+  if (connection.cookies_version != authentication_.cookies_version)
+  {
+    connection.cookies = authentication_.cookies;
+    connection.cookies_version = authentication_.cookies_version;
+  }
+}
+
+void POCOClient::publishSharedCookies(HTTPConnection& connection)
+{
+  // Lock the authentication context's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(authentication_.mutex);
+
+  bool changed = (authentication_.cookies.size() != connection.cookies.size());
+
+  for (NameValueCollection::ConstIterator i = connection.cookies.begin();
+       !changed && i != connection.cookies.end();
+       ++i)
+  {
+    changed = (authentication_.cookies.get(i->first, "") != i->second);
+  }
+
+  authentication_.cookies = connection.cookies;
+  connection.cookies_version = ++authentication_.cookies_version;
+
+  // Only write through to the session store when the session has actually changed.
+  if (changed && !authentication_.p_session_store.isNull())
+  {
+    try
+    {
+      authentication_.p_session_store->save(authentication_.session_key, authentication_.cookies);
+    }
+    catch (const Poco::Exception&)
+    {
+      // The session is still used by this client (i.e. only other clients can not reuse it).
+      ++authentication_.statistics.session_store_failures;
+    }
+  }
+}
+
+void POCOClient::updateCookies(HTTPConnection& connection, const HTTPResponse& response)
+{
   std::vector<HTTPCookie> temp_cookies;
   response.getCookies(temp_cookies);
 
   for (size_t i = 0; i < temp_cookies.size(); ++i)
   {
-    extractAndStoreCookie(temp_cookies[i].toString());
+    if (connection.cookies.find(temp_cookies[i].getName()) != connection.cookies.end())
+    {
+      connection.cookies.set(temp_cookies[i].getName(), temp_cookies[i].getValue());
+    }
+    else
+    {
+      connection.cookies.add(temp_cookies[i].getName(), temp_cookies[i].getValue());
+    }
+  }
+
+  if (!temp_cookies.empty())
+  {
+    publishSharedCookies(connection);
   }
 }
 
-void POCOClient::extractAndStoreCookie(const std::string& cookie_string)
+void POCOClient::extractAndStoreCookie(const std::string& cookie_string, NameValueCollection& cookies)
 {
   // Find the positions of the cookie delimiters.
   size_t position_1 = cookie_string.find_first_of("=");
@@ -535,7 +2516,7 @@ void POCOClient::extractAndStoreCookie(const std::string& cookie_string)
     std::string result = cookie_string.substr(0, position_1++);
     std::string result2 = cookie_string.substr(position_1, position_2 - position_1);
 
-    cookies_.add(result, result2);
+    cookies.add(result, result2);
   }
 }
 
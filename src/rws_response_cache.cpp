@@ -0,0 +1,207 @@
+/***********************************************************************************************************************
+ *
+ * Copyright (c) 2026, ABB Schweiz AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with
+ * or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer in the documentation
+ *      and/or other materials provided with the
+ *      distribution.
+ *    * Neither the name of ABB nor the names of its
+ *      contributors may be used to endorse or promote
+ *      products derived from this software without
+ *      specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ***********************************************************************************************************************
+ */
+
+#include "Poco/ScopedLock.h"
+
+#include "abb_librws/rws_response_cache.h"
+
+using namespace Poco;
+using namespace Poco::XML;
+
+namespace abb
+{
+namespace rws
+{
+/***********************************************************************************************************************
+ * Class definitions: ResponseCache
+ */
+
+/************************************************************
+ * Primary methods
+ */
+
+ResponseCache::ResponseCache()
+:
+ttls_(NUMBER_OF_RESOURCE_CLASSES, 0)
+{}
+
+void ResponseCache::setTTL(const ResourceClass resource_class, const Poco::Int64 ttl)
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(mutex_);
+
+  if (resource_class < NUMBER_OF_RESOURCE_CLASSES)
+  {
+    ttls_[resource_class] = ttl;
+  }
+}
+
+void ResponseCache::setTTL(const Poco::Int64 ttl)
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(mutex_);
+
+  ttls_.assign(NUMBER_OF_RESOURCE_CLASSES, ttl);
+}
+
+Poco::Int64 ResponseCache::getTTL(const ResourceClass resource_class)
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(mutex_);
+
+  return (resource_class < NUMBER_OF_RESOURCE_CLASSES ? ttls_[resource_class] : 0);
+}
+
+bool ResponseCache::lookup(const ResourceClass resource_class,
+                           const std::string& uri,
+                           Poco::AutoPtr<Poco::XML::Document>& p_document)
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(mutex_);
+
+  if (resource_class >= NUMBER_OF_RESOURCE_CLASSES || ttls_[resource_class] <= 0)
+  {
+    return false;
+  }
+
+  std::map<std::string, Entry>::iterator i = entries_.find(uri);
+
+  if (i == entries_.end() || Timestamp() >= i->second.expiry)
+  {
+    if (i != entries_.end())
+    {
+      entries_.erase(i);
+    }
+
+    ++statistics_.misses;
+    return false;
+  }
+
+  // The document's nodes are reference counted without synchronization, so it is only copied while locked.
+  p_document = copy(*i->second.p_document);
+  ++statistics_.hits;
+
+  return true;
+}
+
+void ResponseCache::store(const ResourceClass resource_class,
+                          const std::string& uri,
+                          const Poco::AutoPtr<Poco::XML::Document>& p_document)
+{
+  if (p_document.isNull())
+  {
+    return;
+  }
+
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(mutex_);
+
+  if (resource_class >= NUMBER_OF_RESOURCE_CLASSES || ttls_[resource_class] <= 0)
+  {
+    return;
+  }
+
+  Entry& entry = entries_[uri];
+  entry.resource_class = resource_class;
+  entry.expiry = Timestamp() + ttls_[resource_class];
+  entry.p_document = copy(const_cast<Document&>(*p_document));
+}
+
+void ResponseCache::invalidate(const std::string& uri)
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(mutex_);
+
+  entries_.erase(uri);
+}
+
+void ResponseCache::invalidate(const ResourceClass resource_class)
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(mutex_);
+
+  for (std::map<std::string, Entry>::iterator i = entries_.begin(); i != entries_.end();)
+  {
+    if (i->second.resource_class == resource_class)
+    {
+      entries_.erase(i++);
+    }
+    else
+    {
+      ++i;
+    }
+  }
+}
+
+void ResponseCache::invalidateAll()
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(mutex_);
+
+  entries_.clear();
+}
+
+ResponseCache::Statistics ResponseCache::getStatistics()
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  ScopedLock<Mutex> lock(mutex_);
+
+  return statistics_;
+}
+
+/************************************************************
+ * Auxiliary methods
+ */
+
+Poco::AutoPtr<Poco::XML::Document> ResponseCache::copy(Poco::XML::Document& document)
+{
+  AutoPtr<Document> p_copy(new Document);
+
+  for (Node* p_node = document.firstChild(); p_node; p_node = p_node->nextSibling())
+  {
+    // Document type nodes cannot be imported (and they are not used by RWS).
+    if (p_node->nodeType() != Node::DOCUMENT_TYPE_NODE)
+    {
+      AutoPtr<Node> p_imported(p_copy->importNode(p_node, true));
+      p_copy->appendChild(p_imported);
+    }
+  }
+
+  return p_copy;
+}
+
+} // end namespace rws
+} // end namespace abb
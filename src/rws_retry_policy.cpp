@@ -0,0 +1,135 @@
+/***********************************************************************************************************************
+ *
+ * Copyright (c) 2026, ABB Schweiz AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with
+ * or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer in the documentation
+ *      and/or other materials provided with the
+ *      distribution.
+ *    * Neither the name of ABB nor the names of its
+ *      contributors may be used to endorse or promote
+ *      products derived from this software without
+ *      specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ***********************************************************************************************************************
+ */
+
+#include <algorithm>
+
+#include "Poco/Net/HTTPRequest.h"
+
+#include "abb_librws/rws_retry_policy.h"
+
+namespace abb
+{
+namespace rws
+{
+using Poco::Net::HTTPRequest;
+using Poco::Net::HTTPResponse;
+
+/***********************************************************************************************************************
+ * Class definitions: RetryPolicy
+ */
+
+/************************************************************
+ * Auxiliary methods
+ */
+
+bool RetryPolicy::isIdempotent(const std::string& method)
+{
+  return (method == HTTPRequest::HTTP_GET ||
+          method == HTTPRequest::HTTP_HEAD ||
+          method == HTTPRequest::HTTP_PUT ||
+          method == HTTPRequest::HTTP_DELETE ||
+          method == HTTPRequest::HTTP_OPTIONS);
+}
+
+/***********************************************************************************************************************
+ * Class definitions: DefaultRetryPolicy
+ */
+
+/************************************************************
+ * Primary methods
+ */
+
+DefaultRetryPolicy::DefaultRetryPolicy(const Configuration& configuration)
+:
+configuration_(configuration),
+budget_(configuration.max_budget)
+{
+  random_.seed();
+}
+
+void DefaultRetryPolicy::onRequest()
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  Poco::ScopedLock<Poco::Mutex> lock(mutex_);
+
+  budget_ = std::min(budget_ + configuration_.budget_ratio, configuration_.max_budget);
+}
+
+Poco::Int64 DefaultRetryPolicy::getRetryDelay(const Attempt& attempt)
+{
+  bool idempotent = isIdempotent(attempt.method);
+  bool retryable = false;
+
+  if (idempotent)
+  {
+    retryable = (attempt.number < configuration_.max_attempts_idempotent) &&
+                (attempt.transport_failure ||
+                 attempt.status == HTTPResponse::HTTP_TOO_MANY_REQUESTS ||
+                 attempt.status == HTTPResponse::HTTP_BAD_GATEWAY ||
+                 attempt.status == HTTPResponse::HTTP_SERVICE_UNAVAILABLE ||
+                 attempt.status == HTTPResponse::HTTP_GATEWAY_TIMEOUT);
+  }
+  else
+  {
+    retryable = (attempt.number < configuration_.max_attempts_non_idempotent) &&
+                (!attempt.transport_failure &&
+                 (attempt.status == HTTPResponse::HTTP_TOO_MANY_REQUESTS ||
+                  attempt.status == HTTPResponse::HTTP_SERVICE_UNAVAILABLE));
+  }
+
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  Poco::ScopedLock<Poco::Mutex> lock(mutex_);
+
+  if (!retryable || budget_ < 1.0)
+  {
+    return -1;
+  }
+
+  budget_ -= 1.0;
+
+  // Exponential backoff, with "equal jitter" (i.e. a random delay in [backoff / 2, backoff]).
+  Poco::Int64 backoff = configuration_.base_backoff;
+  for (unsigned int i = 1; i < attempt.number && backoff < configuration_.max_backoff; ++i)
+  {
+    backoff *= 2;
+  }
+  backoff = std::min(backoff, configuration_.max_backoff);
+
+  return backoff / 2 + static_cast<Poco::Int64>(random_.nextDouble() * (backoff / 2));
+}
+
+} // end namespace rws
+} // end namespace abb
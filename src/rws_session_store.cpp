@@ -0,0 +1,378 @@
+/***********************************************************************************************************************
+ *
+ * Copyright (c) 2026, ABB Schweiz AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with
+ * or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer in the documentation
+ *      and/or other materials provided with the
+ *      distribution.
+ *    * Neither the name of ABB nor the names of its
+ *      contributors may be used to endorse or promote
+ *      products derived from this software without
+ *      specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ***********************************************************************************************************************
+ */
+
+#include <fstream>
+#include <sstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#include <windows.h>
+#endif
+
+#include "Poco/Exception.h"
+#include "Poco/File.h"
+#include "Poco/Process.h"
+#include "Poco/Random.h"
+
+#include "abb_librws/rws_session_store.h"
+
+namespace
+{
+/**
+ * \brief A function for converting cookies into a cookie string ("name=value; ...").
+ *
+ * \param cookies for the cookies.
+ *
+ * \return std::string containing the cookie string.
+ */
+std::string toCookieString(const Poco::Net::NameValueCollection& cookies)
+{
+  std::string result;
+
+  for (Poco::Net::NameValueCollection::ConstIterator i = cookies.begin(); i != cookies.end(); ++i)
+  {
+    result += (result.empty() ? "" : "; ") + i->first + "=" + i->second;
+  }
+
+  return result;
+}
+
+/**
+ * \brief A function for parsing a cookie string ("name=value; ...") into cookies.
+ *
+ * \param cookie_string for the cookie string.
+ * \param cookies for containing the parsed cookies.
+ */
+void fromCookieString(const std::string& cookie_string, Poco::Net::NameValueCollection& cookies)
+{
+  std::stringstream ss(cookie_string);
+  std::string cookie;
+
+  while (std::getline(ss, cookie, ';'))
+  {
+    size_t start = cookie.find_first_not_of(' ');
+    size_t position = cookie.find('=');
+
+    if (start != std::string::npos && position != std::string::npos && position > start)
+    {
+      cookies.add(cookie.substr(start, position - start), cookie.substr(position + 1));
+    }
+  }
+}
+
+/**
+ * \brief A class for holding an exclusive advisory lock on a file, which is released when the object goes out of scope.
+ *
+ * The lock is shared by all processes that lock the same file, i.e. it serializes them.
+ */
+class FileLock
+{
+public:
+  /**
+   * \brief A constructor. Blocks until the lock has been acquired.
+   *
+   * \param path for the path to the lock file (it is created if needed).
+   *
+   * \throw Poco::FileException if the lock could not be acquired.
+   */
+  explicit FileLock(const std::string& path)
+  {
+#if defined(__unix__) || defined(__APPLE__)
+    fd_ = ::open(path.c_str(), O_RDWR | O_CREAT, 0600);
+
+    if (fd_ < 0 || ::flock(fd_, LOCK_EX) != 0)
+    {
+      if (fd_ >= 0)
+      {
+        ::close(fd_);
+      }
+
+      throw Poco::FileException("Could not lock the session store", path);
+    }
+#elif defined(_WIN32)
+    handle_ = ::CreateFileA(path.c_str(),
+                            GENERIC_READ | GENERIC_WRITE,
+                            FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                            NULL,
+                            OPEN_ALWAYS,
+                            FILE_ATTRIBUTE_NORMAL,
+                            NULL);
+
+    OVERLAPPED overlapped = OVERLAPPED();
+
+    if (handle_ == INVALID_HANDLE_VALUE ||
+        !::LockFileEx(handle_, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &overlapped))
+    {
+      if (handle_ != INVALID_HANDLE_VALUE)
+      {
+        ::CloseHandle(handle_);
+      }
+
+      throw Poco::FileException("Could not lock the session store", path);
+    }
+#endif
+  }
+
+  /**
+   * \brief A destructor (releases the lock).
+   */
+  ~FileLock()
+  {
+#if defined(__unix__) || defined(__APPLE__)
+    ::flock(fd_, LOCK_UN);
+    ::close(fd_);
+#elif defined(_WIN32)
+    OVERLAPPED overlapped = OVERLAPPED();
+    ::UnlockFileEx(handle_, 0, MAXDWORD, MAXDWORD, &overlapped);
+    ::CloseHandle(handle_);
+#endif
+  }
+
+private:
+  /**
+   * \brief A copy constructor (not allowed).
+   */
+  FileLock(const FileLock&);
+
+  /**
+   * \brief An assignment operator (not allowed).
+   */
+  FileLock& operator=(const FileLock&);
+
+#if defined(__unix__) || defined(__APPLE__)
+  /**
+   * \brief The lock file's descriptor.
+   */
+  int fd_;
+#elif defined(_WIN32)
+  /**
+   * \brief The lock file's handle.
+   */
+  HANDLE handle_;
+#endif
+};
+}
+
+namespace abb
+{
+namespace rws
+{
+/***********************************************************************************************************************
+ * Class definitions: InProcessSessionStore
+ */
+
+/************************************************************
+ * Primary methods
+ */
+
+bool InProcessSessionStore::load(const std::string& key, Poco::Net::NameValueCollection& cookies)
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  Poco::ScopedLock<Poco::Mutex> lock(mutex_);
+
+  std::map<std::string, Poco::Net::NameValueCollection>::const_iterator i = sessions_.find(key);
+
+  if (i == sessions_.end())
+  {
+    return false;
+  }
+
+  cookies = i->second;
+
+  return true;
+}
+
+void InProcessSessionStore::save(const std::string& key, const Poco::Net::NameValueCollection& cookies)
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  Poco::ScopedLock<Poco::Mutex> lock(mutex_);
+
+  sessions_[key] = cookies;
+}
+
+void InProcessSessionStore::remove(const std::string& key)
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  Poco::ScopedLock<Poco::Mutex> lock(mutex_);
+
+  sessions_.erase(key);
+}
+
+/***********************************************************************************************************************
+ * Class definitions: FileSessionStore
+ */
+
+/************************************************************
+ * Primary methods
+ */
+
+const std::string FileSessionStore::LOCK_SUFFIX = ".lock";
+
+bool FileSessionStore::load(const std::string& key, Poco::Net::NameValueCollection& cookies)
+{
+  // Lock the object's mutex. It is released when the method goes out of scope.
+  Poco::ScopedLock<Poco::Mutex> lock(mutex_);
+
+  Sessions sessions = read();
+  Sessions::const_iterator i = sessions.find(key);
+
+  if (i == sessions.end())
+  {
+    return false;
+  }
+
+  cookies.clear();
+  fromCookieString(i->second, cookies);
+
+  return !cookies.empty();
+}
+
+void FileSessionStore::save(const std::string& key, const Poco::Net::NameValueCollection& cookies)
+{
+  // Lock the object's mutex, and the file (against other processes). They are released when the method goes out of
+  // scope, i.e. the whole read-modify-write is serialized.
+  Poco::ScopedLock<Poco::Mutex> lock(mutex_);
+  FileLock file_lock(path_ + LOCK_SUFFIX);
+
+  Sessions sessions = read();
+  sessions[key] = toCookieString(cookies);
+  write(sessions);
+}
+
+void FileSessionStore::remove(const std::string& key)
+{
+  // Lock the object's mutex, and the file (against other processes). They are released when the method goes out of
+  // scope, i.e. the whole read-modify-write is serialized.
+  Poco::ScopedLock<Poco::Mutex> lock(mutex_);
+  FileLock file_lock(path_ + LOCK_SUFFIX);
+
+  Sessions sessions = read();
+
+  if (sessions.erase(key) > 0)
+  {
+    write(sessions);
+  }
+}
+
+/************************************************************
+ * Auxiliary methods
+ */
+
+FileSessionStore::Sessions FileSessionStore::read()
+{
+  Sessions sessions;
+  std::ifstream file(path_.c_str());
+  std::string line;
+
+  // Each line is on the form "<key>\t<cookie string>".
+  while (std::getline(file, line))
+  {
+    size_t position = line.find('\t');
+
+    if (position != std::string::npos)
+    {
+      sessions[line.substr(0, position)] = line.substr(position + 1);
+    }
+  }
+
+  return sessions;
+}
+
+void FileSessionStore::write(const Sessions& sessions)
+{
+  std::string content;
+
+  for (Sessions::const_iterator i = sessions.begin(); i != sessions.end(); ++i)
+  {
+    content += i->first + "\t" + i->second + "\n";
+  }
+
+  // Write to a temporary file first (with a name that is unique across processes), and then replace the file, so
+  // that readers never see a partial file.
+  std::stringstream temporary_path;
+  temporary_path << path_ << "." << Poco::Process::id() << "." << random_.next() << ".tmp";
+
+#if defined(__unix__) || defined(__APPLE__)
+  // Create the file with owner-only permissions (the cookies grant access to the controller).
+  int fd = ::open(temporary_path.str().c_str(), O_WRONLY | O_CREAT | O_EXCL, 0600);
+
+  if (fd < 0)
+  {
+    throw Poco::FileException("Could not create the session store's temporary file", temporary_path.str());
+  }
+
+  bool ok = (::write(fd, content.data(), content.size()) == static_cast<ssize_t>(content.size()));
+  ok = (::close(fd) == 0) && ok;
+#else
+  // Note: Here, the file gets the default permissions of its directory.
+  std::ofstream file(temporary_path.str().c_str(), std::ios::out | std::ios::trunc);
+  file << content;
+  file.close();
+  bool ok = !file.fail();
+#endif
+
+  Poco::File temporary_file(temporary_path.str());
+
+  try
+  {
+    if (!ok)
+    {
+      throw Poco::FileException("Could not write the session store's temporary file", temporary_path.str());
+    }
+
+    // Replaces the file atomically (also on Windows, where an existing file is replaced).
+    temporary_file.renameTo(path_);
+  }
+  catch (const Poco::Exception&)
+  {
+    try
+    {
+      temporary_file.remove();
+    }
+    catch (const Poco::Exception&)
+    {
+      // The temporary file was never created.
+    }
+
+    throw;
+  }
+}
+
+} // end namespace rws
+} // end namespace abb
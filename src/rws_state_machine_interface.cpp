@@ -279,16 +279,14 @@ bool RWSStateMachineInterface::Services::RAPID::runCallByVar(const std::string&
 bool RWSStateMachineInterface::Services::RAPID::runModuleLoad(const std::string& task,
                                                               const std::string& file_path) const
 {
-  RAPIDString temp_file_path(file_path);
-  return p_rws_interface_->setRAPIDSymbolData(task, Symbols::RAPID_MODULE_FILE_PATH_INPUT, temp_file_path) &&
+  return setModuleFilePath(task, file_path) &&
          setRoutineName(task, Procedures::RUN_MODULE_LOAD) && signalRunRAPIDRoutine();
 }
 
 bool RWSStateMachineInterface::Services::RAPID::runModuleUnload(const std::string& task,
                                                                 const std::string& file_path) const
 {
-  RAPIDString temp_file_path(file_path);
-  return p_rws_interface_->setRAPIDSymbolData(task, Symbols::RAPID_MODULE_FILE_PATH_INPUT, temp_file_path) &&
+  return setModuleFilePath(task, file_path) &&
          setRoutineName(task, Procedures::RUN_MODULE_UNLOAD) && signalRunRAPIDRoutine();
 }
 
@@ -310,6 +308,13 @@ bool RWSStateMachineInterface::Services::RAPID::runMoveToCalibrationPosition(con
   return setRoutineName(task, Procedures::RUN_MOVE_TO_CALIBRATION_POSITION) && signalRunRAPIDRoutine();
 }
 
+bool RWSStateMachineInterface::Services::RAPID::setModuleFilePath(const std::string& task,
+                                                                  const std::string& file_path) const
+{
+  RAPIDString temp_file_path(file_path);
+  return p_rws_interface_->setRAPIDSymbolData(task, Symbols::RAPID_MODULE_FILE_PATH_INPUT, temp_file_path);
+}
+
 bool RWSStateMachineInterface::Services::RAPID::setMoveSpeed(const std::string& task, const SpeedData& speed_data) const
 {
   return p_rws_interface_->setRAPIDSymbolData(task, Symbols::RAPID_MOVE_SPEED_INPUT, speed_data);
@@ -760,19 +765,19 @@ bool RWSStateMachineInterface::Services::Watchdog::signalStopRequest() const
  * Auxiliary methods
  */
 
-bool RWSStateMachineInterface::toggleIOSignal(const std::string& iosignal)
+bool RWSStateMachineInterface::toggleIOSignal(const std::string& iosignal, const RWSClient::RequestOptions& options)
 {
   bool result = false;
   int max_number_of_attempts = 5;
 
-  if (isAutoMode().isTrue())
+  if (isAutoMode(options).isTrue())
   {
     for (int i = 0; i < max_number_of_attempts && !result; ++i)
     {
-      result = setIOSignal(iosignal, SystemConstants::IOSignals::LOW);
+      result = setIOSignal(iosignal, SystemConstants::IOSignals::LOW, options);
       if (result)
       {
-        result = (getIOSignal(iosignal) == SystemConstants::IOSignals::LOW);
+        result = (getIOSignal(iosignal, options) == SystemConstants::IOSignals::LOW);
       }
     }
 
@@ -782,10 +787,10 @@ bool RWSStateMachineInterface::toggleIOSignal(const std::string& iosignal)
 
       for (int i = 0; i < max_number_of_attempts && !result; ++i)
       {
-        result = setIOSignal(iosignal, SystemConstants::IOSignals::HIGH);
+        result = setIOSignal(iosignal, SystemConstants::IOSignals::HIGH, options);
         if (result)
         {
-          result = (getIOSignal(iosignal) == SystemConstants::IOSignals::HIGH);
+          result = (getIOSignal(iosignal, options) == SystemConstants::IOSignals::HIGH);
         }
       }
     }
@@ -0,0 +1,503 @@
+/***********************************************************************************************************************
+ *
+ * Copyright (c) 2026, ABB Schweiz AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with
+ * or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the
+ *      above copyright notice, this list of conditions
+ *      and the following disclaimer in the documentation
+ *      and/or other materials provided with the
+ *      distribution.
+ *    * Neither the name of ABB nor the names of its
+ *      contributors may be used to endorse or promote
+ *      products derived from this software without
+ *      specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ***********************************************************************************************************************
+ */
+
+#include <algorithm>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "Poco/DOM/DOMParser.h"
+#include "Poco/Timestamp.h"
+
+#include "abb_librws/rws_subscription_receiver.h"
+
+namespace abb
+{
+namespace rws
+{
+/***********************************************************************************************************************
+ * Class definitions: SubscriptionReceiver
+ */
+
+/************************************************************
+ * Primary methods
+ */
+
+SubscriptionReceiver::SubscriptionReceiver(RWSClient& rws_client, const Configuration& configuration)
+:
+rws_client_(rws_client),
+configuration_(configuration),
+queue_(configuration.queue_capacity > 0 ? configuration.queue_capacity : 1),
+queue_head_(0),
+queue_tail_(0),
+buffer_(0),
+stopping_(false),
+consecutive_timeouts_(0),
+ping_outstanding_(false),
+receiving_(false),
+received_events_(0),
+dispatched_events_(0),
+dropped_events_(0),
+failed_events_(0),
+max_queue_depth_(0),
+recoveries_(0),
+last_gap_duration_(0),
+total_gap_duration_(0),
+receiver_runnable_(*this, &SubscriptionReceiver::receive),
+dispatcher_runnable_(*this, &SubscriptionReceiver::dispatch),
+receiver_thread_("rws_subscription_receiver"),
+dispatcher_thread_("rws_subscription_dispatcher")
+{}
+
+SubscriptionReceiver::~SubscriptionReceiver()
+{
+  stop();
+}
+
+void SubscriptionReceiver::addCallback(const EventCallback& callback)
+{
+  // Lock the callbacks' mutex. It is released when the method goes out of scope.
+  Poco::ScopedLock<Poco::Mutex> lock(callbacks_mutex_);
+
+  callbacks_.push_back(callback);
+}
+
+void SubscriptionReceiver::addRecoveryCallback(const RecoveryCallback& callback)
+{
+  // Lock the callbacks' mutex. It is released when the method goes out of scope.
+  Poco::ScopedLock<Poco::Mutex> lock(callbacks_mutex_);
+
+  recovery_callbacks_.push_back(callback);
+}
+
+RWSClient::RWSResult SubscriptionReceiver::start(const RWSClient::SubscriptionResources& resources)
+{
+  // Lock the state's mutex. It is released when the method goes out of scope.
+  Poco::ScopedLock<Poco::Mutex> lock(state_mutex_);
+
+  RWSClient::RWSResult result;
+
+  if (receiver_thread_.isRunning() || dispatcher_thread_.isRunning())
+  {
+    result.error_message = "start(...): The subscription receiver is already running";
+    return result;
+  }
+
+  result = rws_client_.startSubscription(resources);
+
+  if (result.success)
+  {
+    resources_ = resources;
+    stopping_ = false;
+    stop_event_.reset();
+    p_cancellation_token_ = new CancellationToken();
+    resetLiveness();
+    receiving_ = true;
+
+    dispatcher_thread_.start(dispatcher_runnable_);
+    receiver_thread_.setPriority(configuration_.priority);
+    receiver_thread_.start(receiver_runnable_);
+  }
+
+  return result;
+}
+
+void SubscriptionReceiver::stop()
+{
+  // Lock the state's mutex. It is released when the method goes out of scope.
+  Poco::ScopedLock<Poco::Mutex> lock(state_mutex_);
+
+  if (!receiver_thread_.isRunning() && !dispatcher_thread_.isRunning())
+  {
+    return;
+  }
+
+  stopping_ = true;
+  stop_event_.set();
+
+  // Cancel any ongoing recovery request, and close the WebSocket to unblock the receiver thread.
+  Poco::SharedPtr<CancellationToken> p_cancellation_token = p_cancellation_token_;
+  p_cancellation_token->cancel();
+  rws_client_.forceCloseSubscription();
+  receiver_thread_.join();
+
+  // Only end the subscription once the receiver thread has exited, since it may have been recreating it.
+  rws_client_.endSubscription();
+  rws_client_.forceCloseSubscription();
+
+  // Let the dispatcher thread dispatch any remaining events before it exits.
+  queue_event_.set();
+  dispatcher_thread_.join();
+}
+
+SubscriptionReceiver::Statistics SubscriptionReceiver::getStatistics() const
+{
+  Statistics statistics;
+
+  statistics.received_events = received_events_;
+  statistics.dispatched_events = dispatched_events_;
+  statistics.dropped_events = dropped_events_;
+  statistics.failed_events = failed_events_;
+  statistics.queue_depth = static_cast<size_t>(queue_tail_ - queue_head_);
+  statistics.max_queue_depth = max_queue_depth_;
+  statistics.recoveries = recoveries_;
+  statistics.last_gap_duration = last_gap_duration_;
+  statistics.total_gap_duration = total_gap_duration_;
+
+  return statistics;
+}
+
+/************************************************************
+ * Auxiliary methods
+ */
+
+void SubscriptionReceiver::receive()
+{
+  applyAffinity();
+
+  while (!stopping_)
+  {
+    QueueItem item;
+
+    if (!receiveEvent(item.event))
+    {
+      if (configuration_.recovery_enabled && recover())
+      {
+        continue;
+      }
+
+      break;
+    }
+
+    if (item.event.success)
+    {
+      if (!push(item))
+      {
+        ++dropped_events_;
+      }
+
+      queue_event_.set();
+    }
+  }
+
+  receiving_ = false;
+}
+
+void SubscriptionReceiver::dispatch()
+{
+  while (true)
+  {
+    QueueItem item;
+
+    if (pop(item))
+    {
+      // Lock the callbacks' mutex. It is released when the scope ends.
+      Poco::ScopedLock<Poco::Mutex> lock(callbacks_mutex_);
+
+      if (item.p_recovery.isNull())
+      {
+        for (size_t i = 0; i < callbacks_.size(); ++i)
+        {
+          try
+          {
+            callbacks_[i](item.event);
+          }
+          catch (...)
+          {
+            // A failing callback must not stop the dispatching.
+          }
+        }
+
+        ++dispatched_events_;
+      }
+      else
+      {
+        for (size_t i = 0; i < recovery_callbacks_.size(); ++i)
+        {
+          try
+          {
+            recovery_callbacks_[i](*item.p_recovery);
+          }
+          catch (...)
+          {
+            // A failing callback must not stop the dispatching.
+          }
+        }
+      }
+    }
+    else if (stopping_)
+    {
+      break;
+    }
+    else
+    {
+      queue_event_.tryWait(DISPATCHER_IDLE_WAIT);
+    }
+  }
+}
+
+bool SubscriptionReceiver::receiveEvent(RWSClient::RWSResult& event)
+{
+  POCOClient::POCOResult poco_result = rws_client_.webSocketReceiveFrame(buffer_);
+
+  if (poco_result.status == POCOClient::POCOResult::EXCEPTION_POCO_TIMEOUT)
+  {
+    // No events during the timeout, which is normal if the subscribed resources did not change. However, it is
+    // also how a silently lost WebSocket shows, so check that the peer is still alive.
+    return checkLiveness();
+  }
+
+  resetLiveness();
+
+  int opcode = poco_result.poco_info.websocket.flags & Poco::Net::WebSocket::FRAME_OP_BITMASK;
+
+  if (poco_result.status != POCOClient::POCOResult::OK ||
+      poco_result.poco_info.websocket.flags == 0 ||
+      opcode == Poco::Net::WebSocket::FRAME_OP_CLOSE)
+  {
+    // The WebSocket was lost, closed by the peer, or shut down.
+    return false;
+  }
+
+  ++received_events_;
+
+  if (!decode(buffer_.begin(), buffer_.size(), event))
+  {
+    ++failed_events_;
+  }
+
+  return true;
+}
+
+bool SubscriptionReceiver::checkLiveness()
+{
+  if (configuration_.liveness_timeouts == 0)
+  {
+    return true;
+  }
+
+  if (ping_outstanding_)
+  {
+    // Any received frame (e.g. the pong frame) counts as an answer.
+    if (rws_client_.webSocketLastFrameTime() < ping_time_)
+    {
+      return !ping_time_.isElapsed(static_cast<Poco::Timestamp::TimeDiff>(configuration_.liveness_timeout) * 1000);
+    }
+
+    ping_outstanding_ = false;
+  }
+
+  if (++consecutive_timeouts_ < configuration_.liveness_timeouts)
+  {
+    return true;
+  }
+
+  consecutive_timeouts_ = 0;
+  ping_outstanding_ = true;
+  ping_time_.update();
+
+  return rws_client_.webSocketPing().status == POCOClient::POCOResult::OK;
+}
+
+void SubscriptionReceiver::resetLiveness()
+{
+  consecutive_timeouts_ = 0;
+  ping_outstanding_ = false;
+}
+
+bool SubscriptionReceiver::recover()
+{
+  Poco::Timestamp loss_time;
+  long backoff = configuration_.min_backoff;
+  unsigned int attempts = 0;
+
+  // The requests are cancelled if the receiver is stopped.
+  RWSClient::RequestOptions options;
+  options.setCancellationToken(p_cancellation_token_);
+
+  // Remove the stale subscription group (best effort, the controller may be unreachable), and the dead WebSocket.
+  rws_client_.endSubscription(options);
+  rws_client_.forceCloseSubscription();
+
+  while (!stopping_)
+  {
+    ++attempts;
+
+    if (rws_client_.startSubscription(resources_, options).success)
+    {
+      resetLiveness();
+
+      QueueItem item;
+      item.p_recovery = new Recovery();
+      item.p_recovery->attempts = attempts;
+      item.p_recovery->values = fetchValues(options);
+      item.p_recovery->gap_duration = loss_time.elapsed();
+
+      ++recoveries_;
+      last_gap_duration_ = item.p_recovery->gap_duration;
+      total_gap_duration_ += item.p_recovery->gap_duration;
+
+      if (!push(item))
+      {
+        ++dropped_events_;
+      }
+
+      queue_event_.set();
+
+      return true;
+    }
+
+    // Remove any partially created subscription (i.e. its group, and its WebSocket) before the next attempt.
+    rws_client_.endSubscription(options);
+    rws_client_.forceCloseSubscription();
+
+    // Wait a random time in [backoff / 2, backoff], unless the receiver is stopped in the meantime.
+    long delay = backoff / 2 + static_cast<long>(random_.next(static_cast<Poco::UInt32>(backoff / 2 + 1)));
+    stop_event_.tryWait(delay);
+
+    backoff = std::min(2 * backoff, configuration_.max_backoff);
+  }
+
+  return false;
+}
+
+std::vector<RWSClient::RWSResult> SubscriptionReceiver::fetchValues(const RWSClient::RequestOptions& options)
+{
+  const std::vector<RWSClient::SubscriptionResources::SubscriptionResource>& resources = resources_.getResources();
+
+  // The resource URIs are on the form "<path>;<property>", and the path can be read directly.
+  std::vector<std::string> uris;
+  for (size_t i = 0; i < resources.size(); ++i)
+  {
+    uris.push_back(resources[i].resource_uri.substr(0, resources[i].resource_uri.find(';')));
+  }
+
+  std::vector<POCOClient::POCOResult> poco_results = rws_client_.httpGet(uris, options);
+  std::vector<RWSClient::RWSResult> values(poco_results.size());
+
+  for (size_t i = 0; i < poco_results.size(); ++i)
+  {
+    if (poco_results[i].status == POCOClient::POCOResult::OK &&
+        poco_results[i].poco_info.http.response.status == Poco::Net::HTTPResponse::HTTP_OK)
+    {
+      const std::string& content = poco_results[i].poco_info.http.response.getContent();
+      decode(content.data(), content.size(), values[i]);
+    }
+    else
+    {
+      values[i].error_message = "fetchValues(): Failed to read the current value of " + uris[i];
+    }
+  }
+
+  return values;
+}
+
+bool SubscriptionReceiver::decode(const char* content, const size_t size, RWSClient::RWSResult& event)
+{
+  try
+  {
+    event.p_xml_document = Poco::XML::DOMParser().parseMemory(content, size);
+    event.success = true;
+  }
+  catch (...)
+  {
+    event.success = false;
+    event.error_message = "decode(...): XML parser failed to parse the message";
+  }
+
+  return event.success;
+}
+
+bool SubscriptionReceiver::push(QueueItem& item)
+{
+  const Poco::UInt64 tail = queue_tail_.load(std::memory_order_relaxed);
+  const Poco::UInt64 head = queue_head_.load(std::memory_order_acquire);
+
+  if (tail - head >= queue_.size())
+  {
+    return false;
+  }
+
+  QueueItem& slot = queue_[tail % queue_.size()];
+  slot.event = std::move(item.event);
+  slot.p_recovery.swap(item.p_recovery);
+  queue_tail_.store(tail + 1, std::memory_order_release);
+
+  const size_t depth = static_cast<size_t>(tail + 1 - head);
+
+  if (depth > max_queue_depth_)
+  {
+    max_queue_depth_ = depth;
+  }
+
+  return true;
+}
+
+bool SubscriptionReceiver::pop(QueueItem& item)
+{
+  const Poco::UInt64 head = queue_head_.load(std::memory_order_relaxed);
+  const Poco::UInt64 tail = queue_tail_.load(std::memory_order_acquire);
+
+  if (head == tail)
+  {
+    return false;
+  }
+
+  QueueItem& slot = queue_[head % queue_.size()];
+  item.event = std::move(slot.event);
+  item.p_recovery.swap(slot.p_recovery);
+  queue_head_.store(head + 1, std::memory_order_release);
+
+  return true;
+}
+
+void SubscriptionReceiver::applyAffinity()
+{
+#if defined(__linux__)
+  if (configuration_.cpu_affinity >= 0)
+  {
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(configuration_.cpu_affinity, &cpu_set);
+    pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+  }
+#endif
+}
+
+} // end namespace rws
+} // end namespace abb